@@ -0,0 +1,131 @@
+REBOL [
+	Title: "Interpreter micro-benchmarks"
+	Purpose: {
+		Times the evaluator overheads that most code depends on, so a
+		change that slows them down is visible. Compare the output of
+		two builds on the same machine:  r3 -qs bench.r
+	}
+]
+
+n: 1000000
+x: 0
+f: func [a] [a]
+g: func [a /local b] [b: a]
+c: closure [a] [a]
+d: closure [a /local b] [b: a]
+h: closure [a /local b] [b: a either a > 0 [b] [loop 2 [b: b + 1]]]
+hf: func [a /local b] [b: a either a > 0 [b] [loop 2 [b: b + 1]]]
+fr: func [a] [if a [return a] 0]
+o: make object! [v: 1 w: 2]
+wo: make object! [a: b: c: d: e: f: g: h: i: j: k: l: m: n: o: p: q: r: s: t: 1]
+po: make object! [
+	v: 1 w: "name" x: [1 2 3] y: [a [b c]]
+	get-v: does [v] set-v: func [a] [v: a] add-x: func [a] [append x a]
+]
+pp: prototype make po []
+b: array/initial 1000 1
+s: head insert/dup copy "" "abc" 1000
+code: to binary! mold/only array/initial 100 [f: func [a /local b] [b: a + 1 print ["b:" b]]]
+image: encode-block to block! code
+
+bench: func [name [string!] block [block!] /local t] [
+	recycle
+	t: dt block
+	print [head insert/dup tail copy name " " 24 - length? name round/to 1000 * t/second 0.1 "ms"]
+]
+
+print ["Each benchmark runs" n "iterations." newline]
+
+; Loop overhead:
+bench "loop []" [loop n []]
+bench "repeat i []" [repeat i n []]
+bench "repeat i [i]" [repeat i n [i]]
+bench "for i [i]" [for i 1 n 1 [i]]
+bench "while" [i: 0 while [i < n] [i: i + 1]]
+bench "foreach block" [loop n / 1000 [foreach v b []]]
+bench "foreach [a b] block" [loop n / 500 [foreach [v w] b []]]
+bench "foreach string" [loop n / 3000 [foreach c s []]]
+bench "remove-each" [loop n / 1000 [remove-each v copy b [odd? v]]]
+
+; Function call overhead:
+bench "native call" [loop n [abs 1]]
+bench "action call" [loop n [negate 1]]
+bench "op call" [loop n [1 + 1]]
+bench "func call" [loop n [f 1]]
+bench "func call /local" [loop n [g 1]]
+bench "closure call" [loop n [c 1]]
+bench "closure call /local" [loop n [d 1]]
+bench "func with blocks" [loop n [hf 1]]
+bench "closure with blocks" [loop n [h 1]]
+
+; Non-local exits and errors:
+bench "loop break" [loop n / 10 [loop 10 [break]]]
+bench "func return" [loop n [fr 1]]
+bench "catch throw" [loop n [catch [throw 1]]]
+bench "attempt" [loop n [attempt [1]]]
+bench "attempt error" [loop n / 10 [attempt [1 / 0]]]
+bench "try error" [loop n / 10 [try [1 / 0]]]
+bench "parse call" [loop n / 10 [parse [a] ['a]]]
+
+; Word lookup:
+bench "get word" [loop n [x]]
+bench "set word" [loop n [x: 1]]
+bench "object path" [loop n [o/w]]
+bench "object path, 20 words" [loop n [wo/t]]
+bench "block path" [loop n [b/500]]
+
+; Object creation:
+bench "make object" [loop n / 10 [make po []]]
+bench "make prototype" [loop n / 10 [make pp []]]
+bench "make prototype, use" [loop n / 10 [p: make pp [] p/set-v 2]]
+
+; Loading code:
+bench "scan code" [loop n / 1000 [to block! code]]
+bench "decode block" [loop n / 1000 [decode-block image]]
+
+; Building output:
+rb: make block! 10
+rs: make string! 100
+bench "reduce" [loop n / 10 [reduce [x 1 + 1 'a]]]
+bench "reduce/into reused" [loop n / 10 [reduce/into [x 1 + 1 'a] clear rb]]
+bench "compose" [loop n / 10 [compose [a (x) b]]]
+bench "compose/into reused" [loop n / 10 [compose/into [a (x) b] clear rb]]
+bench "ajoin" [loop n / 10 [ajoin ["a" x "b"]]]
+bench "ajoin/into reused" [loop n / 10 [ajoin/into ["a" x "b"] clear rs]]
+
+; Event dispatch (100 events per WAIT):
+ep: open tcp://:8127
+ep/awake: func [event] [false]
+ev: make event! [type: 'read port: ep]
+eq: system/ports/system/state
+bench "dispatch events" [loop n / 1000 [loop 100 [append system/ports/system ev] while [not empty? eq] [wait 0]]]
+close ep
+
+; Host lookups (hosts file, then cache):
+bench "resolve host" [loop n / 1000 [read dns://localhost]]
+
+; Timers (set and cancel 100 timers a round):
+tps: copy [] loop 100 [append tps open timer://]
+bench "set and cancel timers" [loop n / 1000 [foreach tp tps [write tp [60]] foreach tp tps [clear tp]]]
+foreach tp tps [close tp]
+
+; Process ports (1 MB through cat a round):
+pipe-data: head insert/dup copy #{} #{0123456789abcdef} 65536
+pipe: func [/local p] [
+	p: open [scheme: 'process command: ["cat"]]
+	p/awake: func [event] [
+		switch event/type [
+			wrote [write event/port #{}]
+			read [read event/port]
+			close [return true]
+		]
+		false
+	]
+	write p pipe-data
+	read p
+	wait [p 10]
+	close p
+]
+if 4 == fourth system/version [
+	bench "pipe through process" [loop n / 100000 [pipe]]
+]
@@ -0,0 +1,34 @@
+REBOL [
+	Title: "Boot image startup check"
+	Purpose: {
+		Starts two builds of r3 many times and prints the median startup
+		time of each. Make the first as usual (it loads the boot image)
+		and the second with -DNO_BOOT_IMAGE added to RAPI_FLAGS (it
+		decompresses and scans the boot text). Both must start and run
+		code. Add -DTEST_BOOT_IMAGE to either build to also have it check
+		at startup that the image gives the same boot block as the scan,
+		and that a stale image is refused.
+
+			r3 -qs boot-image.r "./r3-image ./r3-text"
+	}
+]
+
+runs: 40
+exes: parse any [system/script/args ""] none
+if 2 <> length? exes [print "usage: boot-image.r {image-r3 text-r3}" quit/return 2]
+
+startup: func [exe /local times out t] [
+	times: copy []
+	loop runs [
+		out: copy ""
+		t: dt [call/wait/output reform [exe "-qs --do {print 1 + 2}"] out]
+		assert [out = "3^/"]
+		append times t/second * 1000
+	]
+	pick sort times runs / 2
+]
+
+image: startup exes/1
+text: startup exes/2
+print ["boot image:" round/to image 0.1 "ms"]
+print ["boot text: " round/to text 0.1 "ms"]
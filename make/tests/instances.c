@@ -0,0 +1,93 @@
+/*
+** Run several interpreters at once in an INSTANCES build.
+**
+** Four threads each create an interpreter, evaluate some code and
+** destroy it, three times over. Run it under ThreadSanitizer, and
+** under AddressSanitizer with leak detection, to check that the
+** interpreters share nothing but the host devices.
+**
+** Build the core and host objects with -DINSTANCES added to RAPI_FLAGS
+** and HOST_CORE_FLAGS (and -fsanitize=thread or -fsanitize=address),
+** then link this file in place of host-main.o, from make/:
+**
+**   gcc -DINSTANCES -DTO_LINUX -DREB_CORE -DREB_EXE -I../src/include \
+**       -fsanitize=thread -o instances tests/instances.c \
+**       $(OBJS) $(HOST without objs/host-main.o) $(CODECS) \
+**       -ldl -lm -lpthread
+**   ./instances
+**
+** It prints "ok" and exits with zero when every round gave the
+** expected results.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#define OS_LIB_TABLE		// include the host-lib dispatch table
+
+#include "reb-host.h"
+#include "host-lib.h"
+
+#define THREADS 4
+#define ROUNDS 3
+
+extern void Open_StdIO(void);
+
+void Host_Crash(REBYTE *reason) {
+	OS_Crash("REBOL Host Failure", reason);
+}
+
+static REBARGS Args;
+static int Failed[THREADS];
+
+static void *Run(void *arg)
+{
+	int t = (int)(REBUPT)arg;
+	int round;
+	char code[256];
+	RXIARG result;
+
+	for (round = 0; round < ROUNDS; round++) {
+		if (RL_Init(&Args, Host_Lib) != 0) {Failed[t]++; break;}
+		if (RL_Start(0, 0, 0, 0, 0) != 0) Failed[t]++;
+
+		// Every interpreter has its own words, series and GC:
+		sprintf(code, "n: %d b: copy [] repeat i 10000 [append b i] recycle n + length? b", t * 100 + round);
+		if (RL_Do_String((REBYTE *)code, 0, &result) != RXT_INTEGER
+			|| result.int64 != t * 100 + round + 10000) Failed[t]++;
+
+		// Ports and the event loop (timer wheel, device requests):
+		if (RL_Do_String((REBYTE *)"wait 0.01 t: open timer://x write t [0.01] wait [t 1] close t 1", 0, &result) != RXT_INTEGER)
+			Failed[t]++;
+
+		RL_Destroy();
+		if (RL_Instance()) Failed[t]++;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	pthread_t threads[THREADS];
+	int t;
+	int failed = 0;
+
+	Host_Lib = &Host_Lib_Init;
+	memset(&Args, 0, sizeof(Args));
+	Args.options = RO_QUIET;
+
+	// The console is shared by all interpreters; open it first:
+	Open_StdIO();
+
+	for (t = 0; t < THREADS; t++)
+		if (pthread_create(&threads[t], 0, Run, (void *)(REBUPT)t)) return 2;
+	for (t = 0; t < THREADS; t++) {
+		pthread_join(threads[t], 0);
+		failed += Failed[t];
+	}
+
+	OS_Quit_Devices(0);
+	printf(failed ? "failed: %d\n" : "ok\n", failed);
+	return failed ? 1 : 0;
+}
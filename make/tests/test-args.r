@@ -0,0 +1,68 @@
+REBOL []
+; Function arguments (Do_Args): literals and variables are taken
+; directly, anything else is evaluated.
+f2: func [a b] [reduce [a b]]
+x: 10
+g: does [7]
+assert [[1 2] = f2 1 2]
+assert [[10 2] = f2 x 2]
+assert [[7 1] = f2 g 1]
+assert [[2 3] = f2 (1 + 1) 3]
+p: to paren! [1 + 1]
+assert [paren? first f2 p 1]
+
+; An infix op after an arg takes it as its first arg:
+assert [[3 4] = f2 1 + 2 4]
+assert [[1 6] = f2 1 2 * 3]
+assert [[3 12] = f2 1 + 2 x + 2]
+assert [[20 1] = f2 x * 2 1]
+assert [9 = (1 + 2 * 3)]
+assert [22 = (1 + x * 2)]
+assert [5 = add x - 5 0]
+
+; Lit-word and get-word params take the next value as is:
+fl: func ['a b] [reduce [a b]]
+fg: func [:a b] [reduce [a b]]
+assert [[x 3] = fl x 1 + 2]
+assert [[2 3] = fl (1 + 1) 3]
+assert [[x 2] = fg x 2]
+assert [[x 2] = fg x x - 8]
+
+; Refinements:
+fr: func [a /r b /s c] [reduce [a r b s c]]
+assert [(reduce [1 none none none none]) = fr 1]
+assert [(reduce [1 true 2 none none]) = fr/r 1 2]
+assert [(reduce [1 none none true 3]) = fr/s 1 3]
+assert [(reduce [1 true 2 true 3]) = fr/r/s 1 2 3]
+assert [(reduce [2 true 4 none none]) = fr/r 1 + 1 2 * 2]
+assert ["ab" = copy/part "abcd" 2]
+e: try [fr/z 1]
+assert [e/id = 'no-refine]
+
+; Type errors on args:
+fi: func [a [integer!] b [integer!]] [a + b]
+s: "a"
+e: try [fi "a" 1]
+assert [e/id = 'expect-arg]
+assert [e/arg1 = 'fi]
+e: try [fi 1 s]
+assert [e/id = 'expect-arg]
+assert [3 = fi 1 x - 8]
+assert [8 = fi 1 g]
+e: try [add 1 s]
+assert [e/id = 'expect-arg]
+
+; Missing and unset args:
+e: try [f2 1]
+assert [e/id = 'no-arg]
+e: try [f2 1 no-such-word]
+assert [e/id = 'no-value]
+
+; Words of a function that is not running are left to the slow path,
+; which reports them as usual:
+h: func [a] ['a]
+w: h 1
+e: try [do reduce ['f2 1 w]]
+assert [e/id = 'not-defined]
+e: try [do reduce ['f2 w 1]]
+assert [e/id = 'not-defined]
@@ -0,0 +1,47 @@
+REBOL []
+; Closure bodies are shared by all calls; values that escape a call must
+; still be private to it, as if the body had been copied.
+c: closure [n] [func [] [n]]
+a: c 1 b: c 2
+assert [[1 2] = reduce [a b]]
+
+mk: closure [x /local s blk] [s: "" append s x blk: [] append blk x reduce [s blk 'x]]
+r1: mk 1 r2: mk 2
+assert [["1" [1]] = copy/part r1 2]
+assert [["2" [2]] = copy/part r2 2]
+assert [[1 2] = reduce [get r1/3 get r2/3]]
+
+k: closure [x] [if x > 0 [[x]]]
+p: k 5 q: k 6
+assert [[5 6] = reduce [get first p get first q]]
+
+cs: closure [x] [case [x = 1 [[x one]] true [[x other]]]]
+y1: cs 1 y2: cs 2
+assert [[1 2] = reduce [get first y1 get first y2]]
+
+fib: closure [n] [either n < 2 [n] [(fib n - 1) + (fib n - 2)]]
+assert [6765 = fib 20]
+w: closure [x] [while [x > 0] [x: x - 1] x]
+assert [0 = w 10]
+sw: closure [x] [switch x [1 [x + 100] 2 [x + 200]]]
+assert [[101 202] = reduce [sw 1 sw 2]]
+l: closure [x] [lw: 'x set lw 42 x]
+assert [42 = l 1]
+cl: closure [a] [closure [b] [a + b]]
+add5: cl 5 add6: cl 6
+assert [[6 7] = reduce [add5 1 add6 1]]
+o: closure [v] [make object! [get-v: does [v]]]
+o1: o 7 o2: o 8
+assert [[7 8] = reduce [o1/get-v o2/get-v]]
+assert [[either n < 2 [n] [(fib n - 1) + (fib n - 2)]] = body-of :fib]
+recycle
+assert [[1 2] = reduce [a b]]
+; A literal is copied once per call, however often the call evaluates it:
+lc: closure [] [loop 3 [s: "" append s "a"] s]
+assert ["aaa" = lc]
+assert ["aaa" = lc]
+wc: closure [n] [while [n > 0] [b: [] append b n n: n - 1] b]
+assert [[3 2 1] = wc 3]
+assert [[2 1] = wc 2]
+ec: closure [] [loop 2 [try [s: "" append s "x" 1 / 0]] s]
+assert ["xx" = ec]
@@ -0,0 +1,30 @@
+REBOL []
+; ATTEMPT and TRY/EXCEPT with a block skip making the error object:
+assert [none? attempt [1 / 0]]
+assert [2 = attempt [1 + 1]]
+assert [3 = attempt [catch [throw 3]]]
+assert [4 = loop 1 [attempt [break/return 4] 5]]
+assert [6 = try/except [1 / 0] [6]]
+
+; Catchers inside ATTEMPT still get full errors:
+e: none
+attempt [e: try [1 / 0] 1 / 0]
+assert [error? e]
+assert [e/id = 'zero-divide]
+assert [block? e/where]
+f: func [] [try [to integer! "x"]]
+e: none
+attempt [e: f]
+assert [e/id = 'bad-make-arg]
+assert [error? try [attempt [1 / 0] 1 / 0]]
+e: none
+try/except [1 / 0] func [err] [e: err]
+assert [e/id = 'zero-divide]
+
+; Non-local exits:
+fr: func [a] [loop 10 [if a [return 1]] 2]
+assert [1 = fr true]
+assert [2 = fr false]
+assert [3 = catch [loop 10 [throw 3]]]
+assert [10 = repeat i 20 [if i = 10 [break/return i]]]
+assert [true = parse [a] [(attempt [1 / 0]) 'a]]
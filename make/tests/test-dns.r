@@ -0,0 +1,111 @@
+REBOL []
+; The resolver asks the server named by REBOL_DNS; this stub answers
+; over UDP from the same event loop, so lookups must not block.
+queries: 0
+answers: [
+	#{047374756204746573740000010001} #{0A010203}		; stub.test A
+	#{0473747562047465737400001C0001} #{20010DB8000000000000000000000001}
+	#{0676366F6E6C7904746573740000010001} #{}		; v6only.test
+	#{0676366F6E6C79047465737400001C0001} #{20010DB8000000000000000000000002}
+	#{046C6F6F7004746573740000010001} #{7F000001}		; loop.test
+	#{046C6F6F70047465737400001C0001} #{}
+	#{047261636504746573740000010001} #{7F000001}		; race.test
+	#{0472616365047465737400001C0001} #{01000000000000000000000000000001}
+	#{01330132013102313007696E2D61646472046172706100000C0001} #{0473747562047465737400}
+]
+stub: open udp://:5353
+stub/awake: func [event /local q question rdata reply] [
+	if event/type = 'read [
+		queries: queries + 1
+		q: copy event/port/data
+		clear event/port/data
+		question: copy at q 13
+		reply: copy/part q 2
+		either rdata: find/skip answers question 2 [
+			rdata: second rdata
+			append reply #{81800001000000000000}
+			append reply question
+			unless empty? rdata [
+				change at reply 8 #{01}
+				append reply #{C00C}
+				append reply copy/part skip tail question -4 2
+				append reply #{00010000003C00}
+				append reply to char! length? rdata
+				append reply rdata
+			]
+		][
+			append reply #{81830001000000000000}
+			append reply question
+		]
+		write event/port reply
+	]
+	if event/type = 'wrote [read event/port]
+	false
+]
+read stub
+set-env "REBOL_DNS" "127.0.0.1:5353"
+
+lookup: func [host /local p result] [
+	result: 'timeout
+	p: open either tuple? host [compose [scheme: 'dns host: (host)]][join dns:// host]
+	p/awake: func [event] [
+		result: either event/type = 'read [first event/port]['error]
+		true
+	]
+	read p
+	wait [p 3]
+	close p
+	result
+]
+
+assert [10.1.2.3 = lookup "stub.test"]
+assert [2 = queries] ; A and AAAA
+assert ["2001:db8::2" = lookup "v6only.test"]
+assert ['error = lookup "gone.test"]
+assert ["stub.test" = lookup 10.1.2.3]
+
+; Answers are cached for their TTL:
+n: queries
+assert [10.1.2.3 = lookup "STUB.test"]
+assert [n = queries]
+
+; Numeric addresses and /etc/hosts need no query:
+assert [1.2.3.4 = read dns://1.2.3.4]
+assert [127.0.0.1 = read dns://localhost]
+assert [n = queries]
+
+; TCP connections resolve through the same path:
+connected: false
+server: open tcp://:8128
+server/awake: func [event] [if event/type = 'accept [close first event/port] false]
+c: open tcp://loop.test:8128
+c/awake: func [event] [
+	switch event/type [
+		lookup [open event/port]
+		connect [connected: true return true]
+	]
+	false
+]
+wait [c 3]
+assert [connected]
+close c
+
+; IPv6 is tried first; when it does not answer (100:: discards)
+; an IPv4 attempt starts within 250 ms and wins:
+connected: false
+t: now/precise
+c: open tcp://race.test:8128
+c/awake: func [event] [
+	switch event/type [
+		lookup [open event/port]
+		connect [connected: query event/port return true]
+	]
+	false
+]
+wait [c 3]
+assert [object? connected]
+assert [127.0.0.1 = connected/remote-ip]
+assert [1 > to decimal! difference now/precise t]
+close c
+close server
+close stub
@@ -0,0 +1,92 @@
+REBOL []
+; Events queued on the system port are dispatched natively by WAIT:
+seen: copy []
+p: open tcp://:8124
+p/awake: func [event] [append seen event/type true]
+q: open tcp://:8125
+q/awake: func [event] [append seen 'q false]
+append system/ports/system make event! [type: 'read port: p]
+assert [p = wait [p 1]]
+assert [seen = [read]]
+assert [empty? system/ports/system/state]
+
+; WAIT/ONLY leaves the events of other ports queued, in order:
+append system/ports/system make event! [type: 'read port: q]
+append system/ports/system make event! [type: 'wrote port: p]
+assert [p = wait/only [p 1]]
+assert [seen = [read wrote]]
+assert [1 = length? system/ports/system/state]
+assert [none? wait 0.01]
+assert [seen = [read wrote q]]
+
+; An awake that WAITs again does not see its own event twice:
+clear seen
+p/awake: func [event] [append seen event/type wait 0.01 true]
+append system/ports/system make event! [type: 'read port: p]
+append system/ports/system make event! [type: 'close port: p]
+assert [p = wait [p 1]]
+assert [seen = [read close]]
+close p
+close q
+
+; Loopback TCP round trips through the dispatcher:
+n: 0
+server: open tcp://:8123
+server/awake: func [event /local c] [
+	if event/type = 'accept [
+		c: first event/port
+		c/awake: func [e] [
+			switch e/type [
+				read [write e/port copy e/port/data clear e/port/data]
+				wrote [read e/port]
+				close [close e/port]
+			]
+			false
+		]
+		read c
+	]
+	false
+]
+loop 20 [
+	c: open tcp://localhost:8123
+	c/awake: func [e] [
+		switch e/type [
+			lookup [open e/port]
+			connect [write e/port "hi"]
+			wrote [read e/port]
+			read [n: n + 1 close e/port return true]
+		]
+		false
+	]
+]
+loop 100 [if n = 20 [break] wait 0.1]
+assert [n = 20]
+close server
+
+; A full queue keeps the events it refuses and delivers them later:
+eq: system/ports/system/state
+f: open tcp://:8126
+f/awake: func [event] [false]
+ev: make event! [type: 'read port: f]
+loop 65000 [append system/ports/system ev]
+reads: 0
+d: open dns://1.2.3.4
+d/awake: func [event] [if event/type = 'read [reads: reads + 1] false]
+k: 0
+until [n: length? eq read d k: k + 1 n = length? eq] ; the last is refused
+fired: false
+t: open timer://full
+t/awake: func [event] [fired: true false]
+write t [0]
+looked-up: false
+c: open tcp://localhost:8126 ; resolved at once, while the queue is full
+c/awake: func [event] [if event/type = 'lookup [looked-up: true] false]
+loop 100 [if all [empty? eq fired looked-up reads = k] [break] wait 0.05]
+assert [fired]
+assert [looked-up]
+assert [reads = k]
+assert [empty? eq]
+close c
+close t
+close d
+close f
@@ -63,3 +63,15 @@ localtime_r: make routine! compose [[t [pointer] tm [pointer] return: [int64]] (
 print ["localtime:" localtime_r (reflect time_t 'addr) (reflect tm 'addr)]
 
 print ["tm:" mold tm]
+
+labs: make routine! compose [[x [int64] return: [int64]] (libc) "labs"]
+toupper: make routine! compose [[c [int32] return: [int32]] (libc) "toupper"]
+strlen: make routine! compose [[s [pointer] return: [uint64]] (libc) "strlen"]
+assert [9000000000 = labs -9000000000]
+assert [65 = toupper 97]
+assert [5 = strlen "hello"]
+assert [error? try [toupper "a"]]
+assert [[1 2 3] = call-each :labs [-1 2 -3]]
+assert [[1 22] = call-each :strlen ["a" "abcdefghijklmnopqrstuv"]]
+assert [[65 66] = to block! call-each :toupper make vector! [integer! 32 [97 98]]]
+assert [error? try [call-each :fseek [0 0]]]
@@ -0,0 +1,101 @@
+REBOL []
+; FOREACH, MAP-EACH and REMOVE-EACH (Loop_Each).
+
+; Several words take a record at a time; a short last record sets NONE:
+out: copy []
+foreach [a b] [1 2 3 4 5] [append out reduce [a b]]
+assert [out = reduce [1 2 3 4 5 none]]
+out: copy []
+foreach [a b] next [1 2 3 4] [append out reduce [a b]]
+assert [out = reduce [2 3 4 none]]
+out: copy []
+foreach [a b c] "abcdefg" [append out reduce [a b c]]
+assert [out = reduce [#"a" #"b" #"c" #"d" #"e" #"f" #"g" none none]]
+out: copy []
+foreach [a b] "a^(20AC)b" [append out reduce [a b]]
+assert [out = reduce [#"a" #"^(20AC)" #"b" none]]
+out: copy []
+foreach [a b] #{010203} [append out reduce [a b]]
+assert [out = reduce [1 2 3 none]]
+out: copy []
+foreach [a b] make vector! [integer! 32 [1 2 3]] [append out reduce [a b]]
+assert [out = reduce [1 2 3 none]]
+out: copy []
+foreach [p: x] [1 2 3] [append out reduce [index? p x]]
+assert [out = [1 1 2 2 3 3]]
+
+assert [[3 7 5] = map-each [a b] [1 2 3 4 5] [either b [a + b] [a]]]
+assert [[#"b" #"d" #[none]] = map-each [a b] "abcde" [b]]
+
+; BREAK and BREAK/RETURN:
+n: 0
+foreach x [1 2 3] [if x = 2 [break] n: n + 1]
+assert [n = 1]
+assert [20 = foreach x [1 2 3] [if x = 2 [break/return x * 10]]]
+assert [[1] = map-each x [1 2 3] [if x = 2 [break] x]]
+assert [0 = map-each x [1 2 3] [if x = 2 [break/return 0] x]]
+b: [1 2 3 4 5]
+assert [2 = remove-each x b [if x = 4 [break] odd? x]]
+assert [b = [2 4 5]]
+b: [1 2 3 4 5]
+remove-each x b [if x = 4 [break/return 0] odd? x]
+assert [b = [2 4 5]]
+b: [1 2 3 4]
+assert [3 = remove-each x b [if x = 2 [continue] true]]
+assert [b = [2]]
+
+; REMOVE-EACH on blocks and strings (returns the count removed):
+b: [1 2 3 4 5 6]
+assert [3 = remove-each x b [even? x]]
+assert [b = [1 3 5]]
+b: [1 2 3 4 5 6 7 8]
+assert [3 = remove-each x b [find [2 3 6] x]]
+assert [b = [1 4 5 7 8]]
+b: [a 1 b 2 c 3]
+assert [2 = remove-each [k v] b [v = 2]]
+assert [b = [a 1 c 3]]
+b: [1 2 3 4]
+remove-each x next b [odd? x]
+assert [b = [1 2 4]]
+b: [1 2 3]
+assert [0 = remove-each x b [false]]
+assert [b = [1 2 3]]
+assert [3 = remove-each x b [true]]
+assert [empty? b]
+assert [0 = remove-each x [] [true]]
+s: "a-b-c-"
+assert [3 = remove-each c s [c = #"-"]]
+assert [s = "abc"]
+s: "a^(20AC)b^(20AC)c"
+assert [2 = remove-each c s [c = #"^(20AC)"]]
+assert [s = "abc"]
+s: "abcdefg"
+assert [3 = remove-each [a b] s [a = #"c" or (a = #"g")]]
+assert [s = "abef"]
+b: #{00010203}
+remove-each x b [odd? x]
+assert [b = #{0002}]
+
+; The series modified during the loop:
+b: [1 2]
+out: copy []
+foreach x b [append out x if x < 3 [append b x + 2]]
+assert [out = [1 2 3 4]]
+n: 0
+foreach x b: [1 2 3] [n: n + 1 clear b]
+assert [n = 1]
+b: [1 2 3]
+remove-each x b [if x = 1 [append b 4] odd? x]
+assert [b = [2 4]]
+b: [1 2 3 4]
+remove-each x b [if x = 3 [clear at b 3] x = 1]
+assert [b = [2]]
+b: [1 2 3 4]
+remove-each x b [if x = 2 [clear b] x = 1]
+assert [empty? b]
+b: [1 2 3]
+remove-each x b [clear b true]
+assert [empty? b]
+b: [1 2 3 4]
+remove-each x b [if x = 1 [remove b] false]
+assert [b = [2 3 4]]
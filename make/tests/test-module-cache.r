@@ -0,0 +1,50 @@
+REBOL []
+b: [a 'b c: :d /e #f "str^/é" 12 -3 1.5 $2 #"x" 1.2.3 1x2 10:00 1-Jan-2000 %f.r <t> #{0102} [x [y]] (z) p/q :p/q #[none]
+	last]
+c: decode-block encode-block b
+assert [(mold/all b) = mold/all c]
+assert [new-line? find c 'last]
+assert [none? decode-block #{00}]
+assert [none? decode-block copy/part encode-block b 20]
+assert [error? try [encode-block reduce [:print]]]
+
+dir: clean-path %tmp-cache/
+attempt [delete-dir dir]
+make-dir dir
+system/options/module-cache: cache: join dir %cache/
+write dir/m.r {REBOL [type: module name: cache-test exports: [ct-f]]^/ct-f: func [x] [x * 2]}
+
+assert [[ct-f: func [x] [x * 2]] = load dir/m.r]
+assert [1 = length? read cache]
+entry: join cache first read cache
+assert [[ct-f: func [x] [x * 2]] = second decode-block read entry]
+
+; Hits come from the cache:
+key: first decode-block read entry
+write entry encode-block reduce [key [cached 1]]
+assert [[cached 1] = load dir/m.r]
+
+; Changed sources and bad entries are misses:
+write dir/m.r {REBOL [type: module name: cache-test exports: [ct-f]]^/ct-f: func [x] [x * 3]}
+assert [[ct-f: func [x] [x * 3]] = load dir/m.r]
+write entry #{52424931FF}
+assert [[ct-f: func [x] [x * 3]] = load dir/m.r]
+assert [[ct-f: func [x] [x * 3]] = second decode-block read entry]
+
+; A body with a value that does not scan back from its mold is not
+; cached, and an old entry for its source is removed:
+assert [error? try [encode-block reduce [to tag! "a>b"]]]
+write dir/n.r {REBOL []^/x: 1}
+assert [[x: 1] = load dir/n.r]
+n: length? read cache
+write dir/n.r {REBOL []^/x: #[tag! "a>b"]}
+assert ["a>b" = to string! second load dir/n.r]
+assert [n - 1 = length? read cache]
+assert ["a>b" = to string! second load dir/n.r]
+
+import dir/m.r
+assert [6 = ct-f 2]
+
+system/options/module-cache: none
+delete-dir dir
+print "ok"
@@ -0,0 +1,20 @@
+REBOL[]
+assert [$3.75 = ($1.25 + $2.50)]
+assert [$1.2345 = ($1.2345 + $0)]
+assert [$0.01 = ($1 - $0.99)]
+assert [-$0.01 = ($0.99 - $1)]
+assert [$59.97 = ($19.99 * 3)]
+assert ["$0.3" = mold $0.1 + $0.2]
+assert ["$24.24" = mold $24 * $1.01]
+assert ["$33.333333333333333333333333" = mold $100 / 3]
+assert [$1e26 = ($99999999999999999999999999 + $1)]
+assert [error? try [$9e127 * $9e100]]
+assert ["$12345678901234567890123456" = mold $12345678901234567890123456]
+assert [$2 = round/to $1.5 $1]
+assert [$3 = round/to $2.5 $1]
+
+assert [$7.00 = sum [$1.25 $2.50 3 0.25]]
+assert [$0 = sum []]
+assert [$15.97 = dot [$1.99 $5.00] [3 2]]
+assert [error? try [dot [$1] [1 2]]]
+assert [error? try [sum ["x"]]]
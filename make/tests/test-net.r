@@ -0,0 +1,66 @@
+REBOL []
+; IPv6 hosts are strings (a bracketed URL host), and listen ports
+; take IPv6 and IPv4 connections both.
+peers: copy []
+server: open tcp://:8131
+server/awake: func [event /local c] [
+	if event/type = 'accept [
+		c: first event/port
+		append peers query c
+		close c
+	]
+	false
+]
+
+connect: func [url /local c result] [
+	result: 'timeout
+	c: open url
+	c/awake: func [event] [
+		switch event/type [
+			lookup [open event/port]
+			connect [result: query event/port return true]
+			error [result: 'error return true]
+		]
+		false
+	]
+	wait [c 3]
+	close c
+	result
+]
+
+info: connect to url! "tcp://[::1]:8131"
+assert [object? info]
+assert ["::1" = info/remote-ip]
+assert [8131 = info/remote-port]
+info: connect tcp://127.0.0.1:8131
+assert [127.0.0.1 = info/remote-ip]
+wait 0.1
+assert [2 = length? peers]
+assert ["::1" = peers/1/remote-ip]
+assert [127.0.0.1 = peers/2/remote-ip]
+close server
+
+; Nothing listens here:
+assert ['error = connect to url! "tcp://[::1]:8132"]
+
+; UDP datagrams over IPv6:
+got: none
+u: open udp://:8133
+u/awake: func [event] [
+	if event/type = 'read [got: reduce [to string! event/port/data get in query event/port 'remote-ip] return true]
+	false
+]
+read u
+c: open to url! "udp://[::1]:8133"
+c/awake: func [event] [
+	switch event/type [
+		lookup [open event/port]
+		connect [write event/port "ping"]
+	]
+	false
+]
+wait [u 3]
+assert [got/1 = "ping"]
+assert [got/2 = "::1"]
+close c
+close u
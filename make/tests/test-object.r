@@ -0,0 +1,95 @@
+REBOL []
+p: make object! [
+	n: 1
+	b: [1 2]
+	s: "abc"
+	get-n: does [n]
+	add-b: func [x] [append b x]
+	code: [n + 10]
+]
+prototype p
+i: make p []
+j: make p [n: 5 extra: 'x]
+assert [1 = i/n]
+assert [5 = j/get-n]
+assert [1 = i/get-n]
+j/add-b 3
+assert [[1 2 3] = j/b]
+assert [[1 2] = p/b]
+assert [[1 2] = i/b]
+append p/s "d"
+assert ["abc" = i/s]
+assert ["abcd" = p/s]
+k: make p []
+assert ["abcd" = k/s]
+append k/s "e"
+assert ["abcd" = p/s]
+assert [15 = do j/code]
+assert [11 = do i/code]
+assert [same? i do bind [self] i]
+m: make j [n: 7]
+assert [7 = m/get-n]
+assert [[1 2 3] = m/b]
+m/add-b 4
+assert [[1 2 3] = j/b]
+assert [[1 2 3 4] = m/b]
+q: make p []
+assert [[1 2] = select q 'b]
+append q 'z
+assert [in q 'z]
+q2: make p []
+v: values-of q2
+assert [[1 2] = v/2]
+append v/2 9
+assert [[1 2 9] = q2/b]
+c: copy make p []
+assert [[1 2] = c/b]
+q3: make p []
+foreach [w val] q3 [if w = 'b [append val 8]]
+assert [[1 2 8] = q3/b]
+assert [[1 2] = p/b]
+q4: make p []
+set [x y] reduce [q4/n q4/b]
+assert [[1 2] = y]
+; Series referred to from outside the prototype are not lent:
+p2: prototype make object! [b: [1 2]]
+x: p2/b
+q5: make p2 []
+append x 99
+assert [[1 2] = q5/b]
+assert [[1 2 99] = p2/b]
+x: [5]
+q6: make prototype make object! [b: x] []
+append x 6
+assert [[5] = q6/b]
+r: make p []
+recycle
+prototype/off p
+append p/b 7
+assert [[1 2] = r/b]
+assert [1 = r/get-n]
+t: make p []
+append t/b 0
+assert [[1 2 7] = p/b]
+loop 1000 [o: make p [] o/add-b 1]
+recycle
+
+; Path selectors cache the word index per object layout:
+o1: make object! [a: 1 b: 2]
+o2: make object! [b: 3 a: 4]
+o3: make o1 [c: 5]
+get-a: func [o] [o/a]
+assert [[1 4 1 1] = reduce [get-a o1 get-a o2 get-a o3 get-a make o1 []]]
+assert [2 = o1/B]
+append o1 [z: 9]
+assert [9 = o1/z]
+assert [2 = o1/b]
+set-b: func [o v] [o/b: v]
+set-b o2 7
+set-b o1 8
+assert [7 = o2/b]
+assert [8 = o1/b]
+protect/hide in o2 'a
+assert [error? try [get-a o2]]
+assert [1 = get-a o1]
+print "ok"
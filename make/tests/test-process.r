@@ -0,0 +1,93 @@
+REBOL []
+; Output comes in READ events, and its end in a CLOSE event:
+events: copy []
+p: open [scheme: 'process command: ["printf" "a\nb\n"]]
+p/awake: func [event] [
+	append events event/type
+	switch event/type [
+		read [read event/port]
+		close [return true]
+	]
+	false
+]
+read p
+assert [p = wait [p 5]]
+assert [events = [read close]]
+assert ["a^/b^/" = to string! p/data]
+close p
+info: query p
+assert [integer? info/id]
+assert [info/exit-code = 0]
+
+; Output is taken as it is written, not at the exit:
+chunks: copy []
+p: open [scheme: 'process command: "echo 1; sleep 0.2; echo 2" shell: true]
+p/awake: func [event] [
+	switch event/type [
+		read [append chunks to string! event/port/data clear event/port/data read event/port]
+		close [return true]
+	]
+	false
+]
+read p
+assert [p = wait [p 5]]
+assert [chunks = ["1^/" "2^/"]]
+close p
+
+; Output wakes WAIT when it is written, not at the next poll:
+late: none
+p: open [scheme: 'process command: "sleep 0.5; date +%s.%N" shell: true]
+p/awake: func [event] [
+	if event/type = 'read [
+		late: (to decimal! difference now/precise/utc 1-Jan-1970/0:00) - to decimal! trim to string! event/port/data
+		return true
+	]
+	false
+]
+read p
+assert [p = wait [p 5]]
+assert [late < 0.03]
+close p
+
+; Writes queue up (one WROTE event when all is written), and an
+; empty write closes stdin:
+big: head insert/dup copy "" "0123456789abcdef^/" 65536	; 1 MB
+wrote: 0
+p: open [scheme: 'process command: ["cat"]]
+p/awake: func [event] [
+	switch event/type [
+		wrote [wrote: wrote + 1 write event/port ""]
+		read [read event/port]
+		close [return true]
+	]
+	false
+]
+write p big
+write p "end"
+read p
+assert [p = wait [p 10]]
+assert [wrote = 1]
+assert [(join big "end") = to string! p/data]
+close p
+
+; Stderr can be merged into the output, and the exit code is kept:
+p: open [scheme: 'process command: "echo oops >&2; exit 3" shell: true error: 'output]
+p/awake: func [event] [switch event/type [read [read event/port] close [return true]] false]
+read p
+wait [p 5]
+assert ["oops^/" = to string! p/data]
+close p
+assert [3 = get in query p 'exit-code]
+
+; Writing to a process that is gone is an error event, not a crash:
+result: none
+p: open [scheme: 'process command: ["true"]]
+p/awake: func [event] [result: event/type true]
+wait 0.1
+write p big
+wait [p 5]
+assert [result = 'error]
+close p
+
+; Commands that cannot run fail to open:
+assert [error? try [open [scheme: 'process command: ["no-such-command-x"]]]]
@@ -0,0 +1,31 @@
+REBOL []
+; /into inserts at the target position and returns the position after it:
+b: [1 2 3]
+r: reduce/into [4 + 1 6] next b
+assert [b = [1 5 6 2 3]]
+assert [r = [2 3]]
+assert [same? head r b]
+assert [[1 2 3 7] = head reduce/into [3 + 4] tail [1 2 3]]
+assert [[a 2 7 8 x] = head compose/into [a (1 + 1) (reduce [7 8])] [x]]
+assert [[a [2]] = head compose/deep/into [a [(1 + 1)]] copy []]
+assert [(quote (c 3 d)) = head compose/into [c (1 + 2)] quote (d)]
+assert [[x 2 y] = head reduce/no-set/into [1 + 1] next [x y]]
+b: copy [x y]
+assert [[a 1 x y] = head reduce/only/into [a 1] [a] b]
+assert [error? try [reduce/into [1] protect copy []]]
+
+; Reused output buffers keep their storage:
+buf: make block! 10
+loop 3 [clear buf reduce/into [1 2 3] buf]
+assert [buf = [1 2 3]]
+
+; String builders:
+s: copy "abc"
+r: ajoin/into [1 + 1 "x"] next s
+assert [s = "a2xbc"]
+assert [r = "bc"]
+assert ["abc[1 2]" = head mold/into [1 2] tail copy "abc"]
+assert ["fooabc" = head form/into 'foo copy "abc"]
+assert ["aé3bc" = head ajoin/into ["é" 3] next copy "abc"]
+assert ["a3" = ajoin ["a" 1 + 2]]
+assert [error? try [ajoin/into [1] protect copy ""]]
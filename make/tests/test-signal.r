@@ -0,0 +1,28 @@
+REBOL []
+; SIGINT escapes a busy loop. The handler only sets a flag, which the
+; evaluator takes up at the end of the current dose:
+code: {access-os/set 'pid reduce [access-os 'pid 2] n: 0 loop 100000000 [n: n + 1] print "looped" quit/return 3}
+p: open [scheme: 'process command: reduce [to-local-file system/options/boot "-q" "--do" code]]
+p/awake: func [event] [
+	switch event/type [
+		wrote [write event/port ""]	; end the console after the halt
+		read [read event/port]
+		close [return true]
+	]
+	false
+]
+write p "^/"
+read p
+s: now/precise
+assert [p = wait [p 20]]
+assert [(difference now/precise s) < 0:00:10]
+close p
+assert [not find to string! p/data "looped"]
+assert [3 <> get in query p 'exit-code]
+
+; Signals raised by the interpreter itself end the dose too, and the
+; evaluation count stays exact:
+e: stats/evals
+loop 1000 [append copy "" make string! 10000]
+recycle
+assert [(stats/evals - e) >= 2000]
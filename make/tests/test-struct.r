@@ -7,3 +7,36 @@ a: make struct! [
 ]
 print ["a:" mold a]
 
+
+pt: make struct! [x [int32] y [double] tag [uint8]]
+arr: make pt 4
+assert [4 = length? arr]
+assert [[0 0 0 0] = to block! arr/x]
+arr/x: 7
+assert [[7 7 7 7] = to block! arr/x]
+arr/y: [1 2 3 4]
+assert [[1.0 2.0 3.0 4.0] = to block! arr/y]
+arr/x: make vector! [integer! 32 [10 20 30 40]]
+e: arr/3
+e/x: 99
+assert [[10 20 99 40] = to block! arr/x]
+arr/2/y: 2.5
+assert [2.5 = pick arr/y 2]
+assert [none? pick arr 5]
+s: make pt [x: 1 y: 2.0 tag: 3]
+poke arr 1 s
+assert [arr/1 = s]
+assert [error? try [poke arr 5 s]]
+assert [error? try [arr/z]]
+assert [error? try [make make struct! [v [rebval]] 2]]
+assert [52 = length? reflect arr 'values]
+libc: make library! %libc.so.6
+memset: make routine! compose [[p [pointer] c [int32] n [uint64] return: [pointer]] (libc) "memset"]
+memset arr 0 52
+assert [[0 0 0 0] = to block! arr/x]
+; CHANGE on an element writes only that element:
+e: arr/2
+change e reflect s 'values
+assert [arr/2 = s]
+assert [[0 1 0 0] = to block! arr/x]
+assert [error? try [change e reflect arr 'values]]
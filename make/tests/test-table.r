@@ -0,0 +1,70 @@
+REBOL[]
+t: make table! [id integer! city string! price decimal! [
+	1 "Paris" 9.5
+	2 "Oslo" 3.0
+	3 "Paris" 4.5
+	4 "Rome" 7
+	5 "Oslo" 1.5
+]]
+print ["t:" mold t]
+
+assert [5 = length? t]
+assert [[id city price] = words-of t]
+assert [[3 "Paris" 4.5] = t/3]
+assert [none? pick t 9]
+assert [[9.5 3.0 4.5 7.0 1.5] = to block! t/price]
+assert [error? try [t/price/1: 0.0]]
+assert [["Paris" "Oslo" "Paris" "Rome" "Oslo"] = t/city]
+assert [[city] = words-of pick t [city]]
+assert [t = copy t]
+assert [t = do mold t]
+assert [t = load mold/all t]
+
+assert [3 = length? filter t 'price :> 4]
+assert [[2 5] = to block! pick filter t 'city :equal? "oslo" 'id]
+assert [[1 3 4] = to block! pick filter t 'city :<> "Oslo" 'id]
+assert [error? try [filter t 'city :> 1]]
+assert [error? try [filter t 'nope :> 1]]
+
+s: order-by t 'city
+assert [["Oslo" "Oslo" "Paris" "Paris" "Rome"] = s/city]
+assert [[2 5 1 3 4] = to block! s/id]
+assert [[1 4 3 2 5] = to block! pick order-by/reverse t 'price 'id]
+
+g: group-by t 'city 'price :sum
+assert [["Oslo" "Paris" "Rome"] = g/city]
+assert [[4.5 14.0 7.0] = to block! g/price]
+assert [[2 2 1] = to block! pick group-by t 'city 'id :length? 'id]
+assert [[3.0 9.5 7.0] = to block! pick group-by t 'city 'price :max-of 'price]
+assert [[3.5 2.0 4.0] = to block! pick group-by t 'city 'id :mean 'id]
+assert [error? try [group-by t 'city 'city :sum]]
+g: group-by t 'city 'city :length?
+assert [[2 2 1] = to block! g/city-count]
+assert [g = do mold g]
+g: group-by t 'id 'id :sum
+assert [[1 2 3 4 5] = to block! g/id-sum]
+assert [g = do mold g]
+
+; Tables of no columns have no rows:
+assert [0 = length? pick t []]
+assert [0 = length? select t []]
+t2: pick t []
+assert [error? try [append t2 [1]]]
+assert [error? try [append t2 []]]
+assert [0 = length? t2]
+
+n: 0
+foreach [id city] t [if city = "Paris" [n: n + id]]
+assert [n = 4]
+assert [[10.5 5.0 7.5 11.0 6.5] = map-each [id city price] t [id + price]]
+
+append t [6 "Lima" 2.5]
+assert [6 = length? t]
+assert [["Lima" 2.5] = next t/6]
+assert [error? try [append t [7 "Kyiv"]]]
+assert [error? try [append t [7 8 9.0]]]
+assert [6 = length? t]
+clear t
+assert [0 = length? t]
+assert [error? try [make table! [id block!]]]
+recycle
@@ -0,0 +1,87 @@
+REBOL []
+; One-shot timer ports:
+t: open timer://a
+assert [none? read t]
+write t [0.05]
+assert [time? read t]
+assert [(read t) <= 0:00:00.05]
+s: now/precise
+assert [t = wait t]
+dt: difference now/precise s
+assert [dt >= 0:00:00.049]
+assert [dt < 0:00:00.2]
+assert [none? read t]
+write t [1:00]
+clear t
+assert [none? read t]
+assert [none? wait [t 0.01]]
+write t [1]
+write t []
+assert [none? read t]
+close t
+
+; Timers fire in due order, whatever order they were set in:
+fired: copy []
+ts: copy []
+repeat i 5 [
+	append ts p: open timer://x
+	p/awake: func [event] [append fired event/port 5 = length? fired]
+]
+repeat i 5 [write ts/:i reduce [(6 - i) * 0.02]]
+wait [ts/1 1]
+assert [5 = length? fired]
+repeat i 5 [assert [fired/:i = ts/(6 - i)]]
+
+; The awake can set its timer again:
+n: 0
+t: open timer://tick
+t/awake: func [event] [n: n + 1 if n < 3 [write t [0.01]] n = 3]
+write t [0.01]
+assert [t = wait [t 1]]
+assert [n = 3]
+close t
+
+; WAIT times out with sub-millisecond precision:
+s: now/precise
+wait 0.002
+dt: difference now/precise s
+assert [dt >= 0:00:00.002]
+assert [dt < 0:00:00.05]
+
+; Network ports time out by their spec/timeout:
+conns: copy []
+server: open tcp://:8135
+server/awake: func [event] [ ; accepts, never answers
+	if event/type = 'accept [append conns first event/port]
+	false
+]
+result: none
+c: open [scheme: 'tcp host: 127.0.0.1 port-id: 8135 timeout: 0.1]
+c/awake: func [event] [
+	switch event/type [
+		connect [read event/port]
+		error [result: event/port return true]
+		read [result: 'read return true]
+	]
+	false
+]
+; (a timer event first, so the timeout reuses a port event's slot)
+t: open timer://slot
+write t [0.01]
+wait [t 1]
+close t
+s: now/precise
+wait [c 2]
+assert [result = c]
+assert [(difference now/precise s) < 0:00:01]
+close c
+foreach c conns [close c]
+close server
+
+t: open timer://r
+assert [error? try [write t [9223372036854775807]]]
+assert [error? try [write t [-9223372036854775807]]]
+assert [error? try [write t [1e300]]]
+close t
+assert [error? try [wait 1e30]]
+assert [error? try [wait -1e30]]
@@ -0,0 +1,134 @@
+REBOL[]
+v: make vector! [integer! 32 [1 2 3 4]]
+f: make vector! [decimal! 64 [0.5 1.5 2.5 3.5]]
+
+print ["v + 1:" mold v + 1]
+print ["v * v:" mold v * v]
+print ["10 + v:" mold 10 + v]
+print ["f / 0.5:" mold f / 0.5]
+print ["v + f:" mold v + f]
+
+assert [[2 3 4 5] = to block! v + 1]
+assert [[1 4 9 16] = to block! v * v]
+assert [[1.0 3.0 5.0 7.0] = to block! 2 * f]
+assert [error? try [v / 0]]
+assert [[1 3 4 6] = to block! v * 1.5]
+assert [error? try [v + 1e300]]
+assert [error? try [make vector! [integer! 64 [1]] * 1e19]]
+assert [error? try [v + make vector! [integer! 32 3]]]
+
+assert [10 = sum v]
+assert [8.0 = sum f]
+assert [2.5 = mean v]
+assert [1 = min-of v]
+assert [3.5 = max-of f]
+assert [30 = dot v v]
+assert [none? mean make vector! [integer! 8 0]]
+assert [error? try [sum make vector! [integer! 64 [9223372036854775807 1]]]]
+big: make vector! [unsigned integer! 64 [1 2]]
+big/1: -1	; 2 ** 64 - 1
+assert [error? try [max-of big]]
+assert [2 = min-of big]
+assert [error? try [dot big make vector! [integer! 32 [1 1]]]]
+assert [error? try [dot make vector! [integer! 64 [1 1]] big]]
+
+print ["v > 2:" mold mask v :> 2]
+assert [[0 0 1 1] = to block! mask v :> 2]
+assert [[1 1 0 0] = to block! mask v :lesser-or-equal? 2]
+assert [[1 0 1 0] = to block! mask v :equal? make vector! [integer! 32 [1 0 3 0]]]
+
+m: make vector! [integer! 32 3x2 [1 2 3 4 5 6]]
+print ["m:" mold m]
+assert [6 = m/(3x2)]
+assert [[1 4 2 5 3 6] = to block! transpose m]
+assert [[14 32 32 77] = to block! dot m transpose m]
+assert [[6 15] = to block! dot m make vector! [integer! 32 [1 1 1]]]
+assert [error? try [dot m m]]
+assert [[6 15] = to block! sum/rows m]
+assert [[5 7 9] = to block! sum/columns m]
+assert [[2.5 3.5 4.5] = to block! mean/columns m]
+assert [[1 4] = to block! min-of/rows m]
+assert [[4 5 6] = to block! max-of/columns m]
+reshape m 2x3
+assert [4 = m/(2x2)]
+assert [error? try [reshape m 4]]
+
+w: slice at v 2 2
+assert [[2 3] = to block! w]
+assert [5 = sum w]
+assert [error? try [w/1: 0]]
+reshape m 3x2
+assert [[4 5 6] = to block! sum/columns slice at m 4 3]
+remove m
+assert [[2 3 4 5 6] = to block! m]
+assert [m = do mold m]
+b: #{0102030405}
+s: slice next b 3
+b/2: 9
+assert [s = #{090304}]
+assert [error? try [append s 1]]
+; A view stays protected, so it cannot write into its parent:
+protect b
+assert [error? try [unprotect s]]
+assert [error? try [change s 7]]
+unprotect/deep reduce [s]
+assert [error? try [poke s 1 7]]
+unprotect b
+assert [b = #{0109030405}]
+recycle
+assert [#{0304} = slice next s 9]
+; Views end at their own tail, and at the tail of their parent:
+assert [12 = load slice #{3132333435} 2]
+assert [[12] = to block! slice #{3132203334} 2]
+clear skip b 2
+assert [s = #{09}]
+clear b
+assert [empty? s]
+; Views keep their position from the head when the parent moves:
+b: #{0102030405060708}
+s: slice at b 3 3
+remove b
+assert [s = #{040506}]
+append/dup b 0 1000
+assert [s = #{040506}]
+clear skip b 7
+remove/part b 6
+assert [empty? s]
+insert/dup b 7 5000
+assert [empty? s]
+b: append/dup copy #{} #{00010203} 50000
+s: slice at b 100001 4
+remove/part b 70001
+assert [s = copy/part at b 100001 4]
+remove/part b 20000
+assert [s = copy/part at b 100001 4]
+append/dup b 1 100000
+assert [s = copy/part at b 100001 4]
+; Inserts keep a view's offset from the head, in place and at the head:
+b: #{0102030405}
+s: slice at b 3 2
+insert next b #{AA}
+assert [s = #{0203}]
+b: #{0102030405}
+s: slice at b 3 2
+remove b
+assert [s = #{0405}]
+insert b #{FF}
+assert [s = #{0304}]
+clear next b
+assert [empty? s]
+; A view keeps its parent alive:
+s: slice at copy #{0102030405} 2 3
+loop 1000 [copy #{00010203}]
+recycle
+assert [s = #{020304}]
+
+assert [[1 2 3] = to block! to vector! "1 2 3"]
+assert [[1.5 2.0 300.0 -4.25] = to block! to vector! "1.5, 2; 3e2^/-4.25"]
+assert [[1 2 3] = to block! to vector! #{3120322C33}]
+assert [[1.0 2.0 3.5 0.0] = to block! make vector! [decimal! 64 4 "1 2 3.5"]]
+assert [error? try [to vector! "1 x 3"]]
+foreach d [0.1 0.30000000000000004 1e300 5e-324 1.7976931348623157e308 -2.5e-7 123456789.123] [
+	assert [d = load mold d]
+]
+assert ["0.30000000000000004" = mold 0.1 + 0.2]
@@ -21,26 +21,26 @@ REBOL [
 
 add: action [
 	{Returns the addition of two values.}
-	value1 [scalar! date!]
+	value1 [scalar! date! vector!]
 	value2
 ]
 
 subtract: action [
 	{Returns the second value subtracted from the first.}
-	value1 [scalar! date!]
-	value2 [scalar! date!]
+	value1 [scalar! date! vector!]
+	value2 [scalar! date! vector!]
 ]
 
 multiply: action [
 	{Returns the first value multiplied by the second.}
-	value1 [scalar!]
-	value2 [scalar!]
+	value1 [scalar! vector!]
+	value2 [scalar! vector!]
 ]
 
 divide: action [
 	{Returns the first value divided by the second.}
-	value1 [scalar!]
-	value2 [scalar!]
+	value1 [scalar! vector!]
+	value2 [scalar! vector!]
 ]
 
 remainder: action [
@@ -178,14 +178,14 @@ index?: action [
 
 length?: action [
 	{Returns the length (from the current position for series.)}
-	series [series! port! map! tuple! bitset! object! gob! struct! any-word! none!]
+	series [series! port! map! tuple! bitset! object! gob! struct! table! any-word! none!]
 ]
 
 ;-- Series Extraction
 
 pick: action [
 	{Returns the value at the specified position.}
-	aggregate [series! map! gob! pair! date! time! tuple! bitset! port!]
+	aggregate [series! map! gob! pair! date! time! tuple! bitset! port! struct! table!]
 	index {Index offset, symbol, or other value to use as index}
 ]
 
@@ -212,7 +212,7 @@ find: action [
 
 select: action [
 	{Searches for a value; returns the value that follows, else none.}
-	series [series! port! map! object! none!]
+	series [series! port! map! object! table! none!]
 	value [any-type!]
 	/part {Limits the search to a given length or position}
 	length [number! series! pair!]
@@ -251,7 +251,7 @@ to: action [
 
 copy: action [
 	{Copies a series, object, or other value.}
-	value [series! port! map! object! bitset! any-function!] {At position}
+	value [series! port! map! object! bitset! table! any-function!] {At position}
 	/part {Limits to a given length or position}
 	length [number! series! pair!]
 	/deep {Also copies series values within the block}
@@ -281,7 +281,7 @@ insert: action [
 
 append: action [
 	{Inserts element(s) at tail; for series, returns head.}
-	series [series! port! map! gob! object! bitset!] {Any position (modified)}
+	series [series! port! map! gob! object! bitset! table!] {Any position (modified)}
 	value [any-type!] {The value to insert}
 	/part {Limits to a given length or position}
 	length [number! series! pair!]
@@ -310,14 +310,14 @@ change: action [
 
 poke: action [
 	{Replaces an element at a given position.}
-	series [series! port! map! gob! bitset!] {(modified)}
+	series [series! port! map! gob! bitset! struct!] {(modified)}
 	index {Index offset, symbol, or other value to use as index}
 	value [any-type!] {The new value (returned)}
 ]
 
 clear: action [
 	{Removes elements from current position to tail; returns at new tail.}
-	series [series! port! map! gob! bitset! none!] {At position (modified)}
+	series [series! port! map! gob! bitset! table! none!] {At position (modified)}
 ]
 
 trim: action [
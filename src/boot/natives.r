@@ -21,6 +21,8 @@ REBOL [
 ajoin: native [
 	{Reduces and joins a block of values into a new string.}
 	block [block!]
+	/into {Output results into a string with no intermediate storage}
+	out [any-string!]
 ]
 
 also: native [
@@ -170,7 +172,7 @@ forever: native [
 foreach: native [
 	{Evaluates a block for each value(s) in a series.}
 	'word [word! block!] {Word or block of words to set each time (local)}
-	data [series! any-object! map! none!] {The series to traverse}
+	data [series! any-object! map! table! none!] {The series to traverse}
 	body [block!] {Block to evaluate each time}
 ]
 
@@ -202,7 +204,7 @@ loop: native [
 map-each: native [
 	{Evaluates a block for each value(s) in a series and returns them as a block.}
 	'word [word! block!] {Word or block of words to set each time (local)}
-	data [block! vector!] {The series to traverse}
+	data [block! vector! table!] {The series to traverse}
 	body [block!] {Block to evaluate each time}
 ]
 
@@ -614,11 +616,15 @@ mold: native [
 	/only {For a block value, mold only its contents, no outer []}
 	/all  {Use construction syntax}
 	/flat {No indentation}
+	/into {Output results into a string with no intermediate storage}
+	out [any-string!]
 ]
 
 form: native [
 	{Converts a value to a human-readable string.}
 	value [any-type!] {The value to form}
+	/into {Output results into a string with no intermediate storage}
+	out [any-string!]
 ]
 
 new-line: native [
@@ -654,6 +660,16 @@ transcode: native [
 	/error "Do not cause errors - return error object as value in place"
 ]
 
+encode-block: native [
+	{Encodes a block as binary in its scanned form, for DECODE-BLOCK. Word bindings are not kept.}
+	block [block!]
+]
+
+decode-block: native [
+	{Decodes binary made by ENCODE-BLOCK, without scanning it. Returns NONE if not valid.}
+	data [binary!]
+]
+
 echo: native [
     {Copies console output to a file.}
     target [file! none! logic!]
@@ -750,6 +766,12 @@ last: native [
 	value [series! tuple! gob!]
 ]
 
+slice: native [
+	{Returns a read-only view of part of a binary or vector. It shares the data (no copy).}
+	series [binary! vector!] {At the start of the view}
+	length [integer!] {Maximum length of the view}
+]
+
 ;-- Math Natives - nat_math.c
 
 cosine: native [
@@ -825,6 +847,81 @@ shift: native [
 	/logical "Logical shift (sign bit ignored)"
 ]
 
+sum: native [
+	{Returns the sum of the vector elements, or of a block of money! values.}
+	vector [vector! block!]
+	/rows {Of each row of a matrix, as a vector}
+	/columns {Of each column of a matrix, as a vector}
+]
+
+mean: native [
+	{Returns the arithmetic mean of the vector elements (NONE if empty).}
+	vector [vector!]
+	/rows {Of each row of a matrix, as a vector}
+	/columns {Of each column of a matrix, as a vector}
+]
+
+min-of: native [
+	{Returns the smallest vector element (NONE if empty).}
+	vector [vector!]
+	/rows {Of each row of a matrix, as a vector}
+	/columns {Of each column of a matrix, as a vector}
+]
+
+max-of: native [
+	{Returns the largest vector element (NONE if empty).}
+	vector [vector!]
+	/rows {Of each row of a matrix, as a vector}
+	/columns {Of each column of a matrix, as a vector}
+]
+
+dot: native [
+	{Returns the dot product of two vectors (or money! blocks), or the matrix product if either is a matrix.}
+	vector1 [vector! block!]
+	vector2 [vector! block!]
+]
+
+transpose: native [
+	{Returns a transposed copy of a matrix (a plain vector becomes a column).}
+	matrix [vector!]
+]
+
+reshape: native [
+	{Sets the columns of a vector, making it a matrix (shares the data).}
+	vector [vector!]
+	size [pair! integer! none!] {Columns x rows, columns, or NONE for a plain vector}
+]
+
+mask: native [
+	{Compares vector elements, returning a vector of 1 (true) and 0 (false).}
+	vector [vector!]
+	comparator [any-function!] {EQUAL?, NOT-EQUAL?, LESSER?, GREATER? etc. or op}
+	value [vector! number!] {Vector of the same length, or number}
+]
+
+filter: native [
+	{Returns a table of the rows where a column compares true with a value.}
+	table [table!]
+	column [word!]
+	comparator [any-function!] {EQUAL?, NOT-EQUAL?, LESSER?, GREATER? etc. or op}
+	value [number! string!]
+]
+
+order-by: native [
+	{Returns a copy of a table with the rows sorted by a column (stable).}
+	table [table!]
+	column [word!]
+	/reverse {Largest first}
+]
+
+group-by: native [
+	{Returns a table of the distinct values of a key column and an aggregate of another column for each.}
+	table [table!]
+	key [word!] {Column to group by}
+	column [word!] {Column to aggregate}
+	aggregate [any-function!] {SUM, MEAN, MIN-OF, MAX-OF or LENGTH? (count)}
+]
+
 ;-- New, hackish stuff:
 
 ++: native [
@@ -863,6 +960,12 @@ resolve: native [
 	/extend "Add source words to the target if necessary"
 ]
 
+prototype: native [
+	{Makes objects derived from this one share its values until they are used.}
+	object [object!] {(returned)}
+	/off {Copy all values when objects are made (default)}
+]
+
 ;in-context: native [
 ;	{Set the default context for global words.}
 ;	context [object!]
@@ -975,6 +1078,12 @@ do-callback: native [
 	event [event!] "Callback event"
 ]
 
+call-each: native [
+	{Calls a routine or command for each group of arguments, returning the results as a block or vector.}
+	routine [routine! command!]
+	args [block! vector!] "Arguments of all the calls, one call after another"
+]
+
 
 limit-usage: native [
 	"Set a usage limit only once (used for SECURE)."
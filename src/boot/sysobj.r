@@ -134,6 +134,7 @@ options: context [  ; Options supplied to REBOL during startup
 	decimal-digits: 15 ; Max number of decimal digits to print.
 	module-paths: [%./]
 	default-suffix: %.reb ; Used by IMPORT if no suffix is provided
+	module-cache: none ; Directory of scanned LOAD and IMPORT files (none: off)
 	file-types: []
 	result-types: none
 ]
@@ -222,6 +223,7 @@ standard: context [
 	port-spec-net: make port-spec-head [
 		host: none
 		port-id: 80
+		timeout: none	; I/O timeout (enforced natively)
 			none
 	]
 
@@ -236,6 +238,12 @@ standard: context [
 	port-spec-signal: make port-spec-head [
 		mask: [all]
 	]
+
+	port-spec-process: make port-spec-head [
+		command: none	; string, file or block (as for CALL)
+		shell: false	; run the command from the shell
+		error: none		; none: inherit stderr, 'output: merge into output
+	]
 	
 	file-info: context [
 		name:
@@ -101,5 +101,6 @@ REBOL [
 	handle      self        0           -        -       -      -   -  
 	struct      self        struct      *        *       *      *   -
 	library     self     	library     -        -       -      -   -
+	table       self        table       *        *       *      *   -
 	utype       self        utype       -        -       -      -   -  
 
@@ -63,6 +63,7 @@ set-path	["definition of a path's value" block]
 set-word	["definition of a word's value" word]
 string		["string series of characters" string]
 struct		["native structure definition" block]
+table		["columns of typed values" block]
 tag			["markup string (HTML or XML)" string]
 task		["evaluation environment" object]
 time		["time of day or duration" scalar]
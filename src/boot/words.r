@@ -166,6 +166,8 @@ udp
 clipboard
 serial
 signal
+timer
+process
 
 ; Serial parameters
 ; Parity
@@ -297,3 +299,9 @@ pid
 ;call/info
 id
 exit-code
+
+;process port spec
+output
+
+;system port dispatch
+wake-up
@@ -27,6 +27,8 @@
 **	  There are two types of global variables:
 **		process vars - single instance for main process
 **		thread vars - duplicated within each R3 task
+**	  With INSTANCES (reb-config.h) both are thread-local, one set
+**	  per embedded interpreter.
 **
 ***********************************************************************/
 
@@ -39,7 +41,7 @@
 #undef PVAR
 #undef TVAR
 
-#define PVAR
+#define PVAR INSTANCE
 #define TVAR THREAD
 
 #include "sys-globals.h"
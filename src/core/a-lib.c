@@ -39,6 +39,8 @@
 REBOL_HOST_LIB *Host_Lib;
 #endif
 
+extern INSTANCE REBCNT Ext_Next;	// f-extension.c
+
 #include "reb-lib.h"
 
 //#define DUMP_INIT_SCRIPT
@@ -106,7 +108,7 @@ extern int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result);
 	int marker;
 	REBUPT bounds;
 
-	Host_Lib = lib;
+	if (Host_Lib != lib) Host_Lib = lib; // shared by all instances
 
 	if (Host_Lib->size < HOST_LIB_SIZE) return 1;
 	if (((HOST_LIB_VER << 16) + HOST_LIB_SUM) != Host_Lib->ver_sum) return 2;
@@ -269,9 +271,13 @@ extern int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result);
 **		trap. Note that control must be passed back to REBOL for the
 **		signal to be recognized and handled.
 **
+**		It can be called from a signal handler, so it only sets a
+**		flag. Do_Signals picks it up at the end of the current
+**		evaluation dose.
+**
 ***********************************************************************/
 {
-	SET_SIGNAL(SIG_ESCAPE);
+	Eval_Escape = 1;
 }
 
 
@@ -801,6 +807,7 @@ RL_API REBUPT RL_Series(REBSER *series, REBCNT what)
 	case RXI_SER_LEFT: return SERIES_AVAIL(series);
 	case RXI_SER_SIZE: return SERIES_REST(series);
 	case RXI_SER_WIDE: return SERIES_WIDE(series);
+	case RXI_SER_TYPE: return series->size & 0xff; // vectors only
 	}
 	return 0;
 }
@@ -1106,6 +1113,81 @@ RL_API int RL_Callback(RXICBI *cbi)
 	}
 }
 
+/***********************************************************************
+**
+*/ RL_API void *RL_Series_Data(REBSER *series, u32 index, u32 *len)
+/*
+**	Get a pointer to the data of a series, for direct access.
+**
+**	Returns:
+**		A pointer to the unit at the index of the series data.
+**	Arguments:
+**		series - a string, binary, vector or image series pointer
+**		index - index from beginning (zero-based)
+**		len - if not zero, set to the number of units from the index
+**			to the tail (zero if the index is at or past the tail)
+**	Notes:
+**		The data is not copied, so it can be read and written in place.
+**		Units are RL_SERIES(series, RXI_SER_WIDE) bytes, and the numbers
+**		of a vector are of RL_SERIES(series, RXI_SER_TYPE).
+**		Series move in memory when they expand, so do not keep the
+**		pointer past the command or after adding to the series.
+*/
+{
+	if (len) *len = (index >= SERIES_TAIL(series)) ? 0 : SERIES_TAIL(series) - index;
+	return SERIES_SKIP(series, index);
+}
+
+/***********************************************************************
+**
+*/ RL_API void *RL_Instance(void)
+/*
+**	Get the interpreter of the calling thread.
+**
+**	Returns:
+**		An opaque handle for the interpreter, or zero if RL_Init
+**		has not been called on this thread (or RL_Destroy was).
+**	Notes:
+**		When the core is built with INSTANCES (see reb-config.h),
+**		each thread that calls RL_Init gets its own interpreter,
+**		and every other RL_ call uses the interpreter of the thread
+**		it is made on. Values and series must never be passed from
+**		one interpreter to another. Without INSTANCES there is only
+**		one interpreter, and all threads share the same handle.
+*/
+{
+	return Root_Context;
+}
+
+/***********************************************************************
+**
+*/ RL_API void RL_Destroy(void)
+/*
+**	Free the interpreter of the calling thread.
+**
+**	Returns:
+**		nothing
+**	Notes:
+**		All memory the interpreter allocated is released, so no series
+**		or value from it may be used after this call. RL_Init can then
+**		be called again on the thread to make a fresh interpreter.
+**		Ports should be closed first. Requests still pending on the
+**		host devices are dropped; the devices themselves are shared
+**		by the whole process (initialized once, by the first thread
+**		that uses them) and remain open until OS_Quit_Devices.
+*/
+{
+	if (!Root_Context) return;
+
+	Dispose_Core();
+
+	Root_Context = 0;
+	Task_Context = 0;
+	Lib_Context = 0;
+	Sys_Context = 0;
+	Ext_Next = 0;
+}
+
 #include "reb-lib-lib.h"
 
 /***********************************************************************
@@ -33,12 +33,12 @@
 #define EVAL_DOSE 10000
 
 // Boot Vars used locally:
-static	REBCNT	Native_Count;
-static	REBCNT	Native_Limit;
-static	REBCNT	Action_Count;
-static	REBCNT	Action_Marker;
-static	REBFUN  *Native_Functions;
-static	BOOT_BLK *Boot_Block;
+static	INSTANCE REBCNT	Native_Count;
+static	INSTANCE REBCNT	Native_Limit;
+static	INSTANCE REBCNT	Action_Count;
+static	INSTANCE REBCNT	Action_Marker;
+static	INSTANCE REBFUN  *Native_Functions;
+static	INSTANCE BOOT_BLK *Boot_Block;
 
 extern const REBYTE Str_Banner[];
 
@@ -142,42 +142,81 @@ extern const REBYTE Str_Banner[];
 }
 
 
+/***********************************************************************
+**
+*/	static REBSER *Scan_Boot_Text(void)
+/*
+**		Decompress binary data in Native_Specs to get the textual source
+**		of the function specs of the native routines.  (This compressed
+**		array lives in b-boot.c which is generated by make-boot.r)
+**		Then load that into a Rebol series as the boot block.  Note that
+**		the first four bytes of Native_Specs is a little-endian 32-bit
+**		length of the uncompressed spec data.
+**
+***********************************************************************/
+{
+	REBSER spec;
+	REBSER *text;
+	REBSER *boot;
+	REBINT textlen;
+
+	// REVIEW: This is a nasty casting away of a const.  But there's
+	// nothing that can be done about it as long as Decompress takes
+	// a REBSER, as the data field is not const
+	spec.data = ((REBYTE*)Native_Specs) + 4;
+	spec.tail = NAT_SPEC_SIZE;
+
+	textlen = Bytes_To_REBCNT(Native_Specs);
+	text = Decompress(&spec, 0, -1, textlen, 0);
+	if (!text || (STR_LEN(text) != textlen)) Crash(RP_BOOT_DATA);
+	boot = Scan_Source(STR_HEAD(text), textlen);
+	//Dump_Block_Raw(boot, 0, 2);
+	Free_Series(text);
+
+	return boot;
+}
+
+
 /***********************************************************************
 **
 */	static void Load_Boot(void)
 /*
-**		Decompress and scan in the boot block structure.  Can
+**		Load (or decompress and scan) the boot block structure.  Can
 **		only be called at the correct point because it will
 **		create new symbols.
 **
+**		Build with NO_BOOT_IMAGE to always scan the text, and with
+**		TEST_BOOT_IMAGE to check at startup that the image gives the
+**		same block as the scan, and that a stale image is refused.
+**
 ***********************************************************************/
 {
 	REBSER *boot;
 
-	// Decompress binary data in Native_Specs to get the textual source
-	// of the function specs of the native routines.  (This compressed
-	// array lives in b-boot.c which is generated by make-boot.r)
-	// Then load that into a Rebol series as `boot`.  Note that the
-	// first four bytes of Native_Specs is a little-endian 32-bit
-	// length of the uncompressed spec data.
+	// Use the boot image made by make-boot.r if there is one. It has
+	// the boot block in scanned form (see Load_Block_Image). If it is
+	// not valid (e.g. from another build), the text is scanned:
+	boot = 0;
+#if defined(BOOT_IMAGE_SIZE) && !defined(NO_BOOT_IMAGE)
+	boot = Load_Block_Image((REBYTE *)Boot_Image, BOOT_IMAGE_SIZE);
+#endif
+	if (!boot) boot = Scan_Boot_Text();
+
+#if defined(TEST_BOOT_IMAGE) && defined(BOOT_IMAGE_SIZE)
 	{
-		REBSER spec;
-		REBSER *text;
-		REBINT textlen;
-
-		// REVIEW: This is a nasty casting away of a const.  But there's
-		// nothing that can be done about it as long as Decompress takes
-		// a REBSER, as the data field is not const
-		spec.data = ((REBYTE*)Native_Specs) + 4;
-		spec.tail = NAT_SPEC_SIZE;
-
-		textlen = Bytes_To_REBCNT(Native_Specs);
-		text = Decompress(&spec, 0, -1, textlen, 0);
-		if (!text || (STR_LEN(text) != textlen)) Crash(RP_BOOT_DATA);
-		boot = Scan_Source(STR_HEAD(text), textlen);
-		//Dump_Block_Raw(boot, 0, 2);
-		Free_Series(text);
+		REBSER *ser = Load_Block_Image((REBYTE *)Boot_Image, BOOT_IMAGE_SIZE);
+		REBVAL image;
+		REBVAL text;
+
+		if (!ser) Crash(RP_BOOT_DATA);
+		Set_Block(&image, ser);
+		Set_Block(&text, Scan_Boot_Text());
+		if (Cmp_Block(&image, &text, TRUE)) Crash(RP_BOOT_DATA);
+		// A truncated or shifted image is refused (and so scanned):
+		if (Load_Block_Image((REBYTE *)Boot_Image, BOOT_IMAGE_SIZE - 1)) Crash(RP_BOOT_DATA);
+		if (Load_Block_Image((REBYTE *)Boot_Image + 1, BOOT_IMAGE_SIZE - 1)) Crash(RP_BOOT_DATA);
 	}
+#endif
 
 	Set_Root_Series(ROOT_BOOT, boot, "boot block");	// Do not let it get GC'd
 
@@ -374,6 +413,36 @@ extern const REBYTE Str_Banner[];
 }
 
 
+/***********************************************************************
+**
+*/	static void Init_Shared_Args(void)
+/*
+**		Flag the args of the natives that only evaluate a block
+**		(or test it) and never keep it. These can be given the
+**		code blocks of a shared closure body without a copy.
+**
+***********************************************************************/
+{
+	static const char *names[] = {
+		"if", "either", "unless", "all", "any", "case", "switch",
+		"catch", "try", "attempt", "loop", "while", "until", "forever",
+		"do", "reduce", 0
+	};
+	const char **name;
+	REBVAL *func;
+	REBVAL *args;
+
+	for (name = names; *name; name++) {
+		func = Find_Word_Value(Lib_Context, Make_Word((REBYTE *)*name, 0));
+		if (!func || !IS_NATIVE(func)) Crash(9913);
+		// Refinement args are not flagged (Do_Args checks the path):
+		args = BLK_SKIP(VAL_FUNC_ARGS(func), 1);
+		for (; NOT_END(args) && IS_WORD(args); args++)
+			VAL_SET_OPT(args, OPTS_SHARED);
+	}
+}
+
+
 /***********************************************************************
 **
 */	static void Init_Natives(void)
@@ -406,6 +475,7 @@ extern const REBYTE Str_Banner[];
 	Action_Marker = SERIES_TAIL(Lib_Context)-1; // Save index for action words.
 	Do_Global_Block(VAL_SERIES(&Boot_Block->actions), -1);
 	Do_Global_Block(VAL_SERIES(&Boot_Block->natives), -1);
+	Init_Shared_Args();
 }
 
 
@@ -975,6 +1045,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Eval_Cycles = 0;
 	Eval_Dose = EVAL_DOSE;
 	Eval_Signals = 0;
+	Eval_Escape = 0;
 	Eval_Sigmask = ALL_BITS;
 
 	// errors? problem with PG_Boot_Phase shared?
@@ -1031,6 +1102,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Eval_Dose = EVAL_DOSE;
 	Eval_Limit = 0;
 	Eval_Signals = 0;
+	Eval_Escape = 0;
 	Eval_Sigmask = ALL_BITS; /// dups Init_Task
 
 	Init_StdIO();
@@ -1112,3 +1184,33 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 
 	DOUT("Boot done");
 }
+
+
+/***********************************************************************
+**
+*/	void Dispose_Core(void)
+/*
+**		Free all memory held by the interpreter of this thread.
+**		The reverse of Init_Core. Host devices are shared by all
+**		interpreters of the process and are not closed here.
+**
+***********************************************************************/
+{
+	Dispose_StdIO();
+	Dispose_Ports();
+	Dispose_Mold();
+	Dispose_CRC();
+
+	Free_Mem(White_Chars, 34);
+	Free_Mem(Upper_Cases, UNICODE_CASES * sizeof(REBUNI));
+	Free_Mem(Lower_Cases, UNICODE_CASES * sizeof(REBUNI));
+	Free_Mem(PG_Boot_Strs, RS_MAX * sizeof(REBYTE *));
+
+	Dispose_Memory();
+
+	Free_Mem(PG_Reb_Stats, sizeof(*PG_Reb_Stats));
+	Free_Mem(Reb_Opts, sizeof(*Reb_Opts));
+	PG_Reb_Stats = 0;
+	Reb_Opts = 0;
+	PG_Boot_Phase = BOOT_START;
+}
@@ -28,7 +28,7 @@
 ***********************************************************************/
 #include "sys-core.h"
 
-static REBARGS Main_Args;	// Not multi-threaded
+static INSTANCE REBARGS Main_Args;	// Not multi-threaded
 
 /***********************************************************************
 **
@@ -50,7 +50,7 @@ enum Eval_Types {
 	ET_END			// end of block
 };
 
-static jmp_buf *Halt_State = 0;  //!!!!!!!!!! global?
+static INSTANCE jmp_buf *Halt_State = 0;  //!!!!!!!!!! global?
 
 /*
 void T_Error(REBCNT n) {;}
@@ -284,7 +284,7 @@ void Trace_Arg(REBINT num, REBVAL *arg, REBVAL *path)
 /*
 ***********************************************************************/
 {
-	static char tracebuf[64];
+	static INSTANCE char tracebuf[64];
 	int depth;
 	int len = MIN(60, limit);
 	CHECK_DEPTH(depth);
@@ -652,9 +652,39 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 	tos = DS_NEXT;
 	DSP += ds;
 	for (; ds > 0; ds--) SET_NONE(tos++);
+	ds = dsp;
+
+	// Fixed args (see Check_Func_Spec) given as a literal or a variable
+	// are taken without Do_Next. Other args continue below.
+	if (IS_FIXED_DESC(VAL_FUNC_DESC(func)) && !Trace_Flags && (!path || IS_END(path))) {
+		REBCNT n = FUNC_DESC_ARGC(VAL_FUNC_DESC(func));
+		REBFLG op = IS_OP(func);
+		REBVAL *var;
+
+		if (op) n--;
+		for (; n > 0; n--, args++, ds++) {
+			// Lookups here must not trap: anything unusual is left to
+			// the slow path below, which reports it in order.
+			tos = value = BLK_SKIP(block, index);
+			if (IS_WORD(value)) {
+				if (!(tos = Get_Var_No_Trap(value))) break;
+				if (ANY_FUNC(tos) || VAL_TYPE(tos) <= REB_UNSET || IS_ERROR(tos)
+					|| IS_LIT_WORD(tos) || IS_FRAME(tos)) break;
+			}
+			else if (EVAL_TYPE(value) != ET_SELF || VAL_GET_OPT(value, OPTS_SHARED)) break;
+			// An infix op after the arg takes it as its first arg:
+			value++;
+			if (!op && IS_WORD(value)) {
+				if (!(var = Get_Var_No_Trap(value)) || IS_OP(var)) break;
+			}
+			if (!TYPE_CHECK(args, VAL_TYPE(tos)))
+				Trap3(RE_EXPECT_ARG, Func_Word(dsf), args, Of_Type(tos));
+			DS_Base[ds] = *tos;
+			index++;
+		}
+	}
 
 	// Go thru the word list args:
-	ds = dsp;
 	for (; NOT_END(args); args++, ds++) {
 
 		func = &DS_Base[func_offset]; //DS_Base could be changed
@@ -665,6 +695,20 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 		switch (VAL_TYPE(args)) {
 
 		case REB_WORD:		// WORD - Evaluate next value
+			// A code block of a closure body can be given as is to a native
+			// that only evaluates it (see Init_Shared_Args):
+			value = BLK_SKIP(block, index);
+			if (
+				VAL_GET_OPT(args, OPTS_SHARED)
+				&& VAL_GET_OPT(value, OPTS_SHARED)
+				&& IS_BLOCK(value)
+				&& (!path || IS_END(path))
+				&& !(IS_WORD(value+1) && VAL_WORD_FRAME(value+1) && IS_OP(Get_Var(value+1)))
+			) {
+				DS_Base[ds] = *value;
+				index++;
+				break;
+			}
 			index = Do_Next(block, index, IS_OP(func));
 			// THROWN is handled after the switch.
 			if (index == END_FLAG) Trap2(RE_NO_ARG, Func_Word(dsf), args);
@@ -682,6 +726,7 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 				else {
 					index++;
 					DS_Base[ds] = *value;
+					if (VAL_GET_OPT(value, OPTS_SHARED)) Unshare_Value(&DS_Base[ds]);
 				}
 			} else
 				SET_UNSET(&DS_Base[ds]); // allowed to be none
@@ -689,7 +734,9 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 
 		case REB_GET_WORD:	// :WORD - Get value
 			if (index < BLK_LEN(block)) {
-				DS_Base[ds] = *BLK_SKIP(block, index);
+				value = BLK_SKIP(block, index);
+				DS_Base[ds] = *value;
+				if (VAL_GET_OPT(value, OPTS_SHARED)) Unshare_Value(&DS_Base[ds]);
 				index++;
 			} else
 				SET_UNSET(&DS_Base[ds]); // allowed to be none
@@ -765,6 +812,12 @@ more_path:
 	REBCNT sigs;
 	REBCNT mask;
 
+	// An escape from a signal handler only sets a flag (see RL_Escape):
+	if (Eval_Escape) {
+		Eval_Escape = 0;
+		SET_FLAG(Eval_Signals, SIG_ESCAPE);
+	}
+
 	// Accumulate evaluation counter and reset countdown:
 	if (Eval_Count <= 0) {
 		//Debug_Num("Poll:", (REBINT) Eval_Cycles);
@@ -828,7 +881,7 @@ more_path:
 	//CHECK_MEMORY(1);
 	CHECK_STACK(&value);
 	if ((DSP + 20) > (REBINT)SERIES_REST(DS_Series)) Expand_Stack(STACK_MIN); //Trap0(RE_STACK_OVERFLOW);
-	if (--Eval_Count <= 0 || Eval_Signals) Do_Signals();
+	POLL_SIGNALS();
 
 	value = BLK_SKIP(block, index);
 	//if (Trace_Flags) Trace_Eval(block, index);
@@ -851,6 +904,7 @@ reval:
 
 	case ET_SELF:
 		DS_PUSH(value);
+		if (VAL_GET_OPT(value, OPTS_SHARED)) Unshare_Value(DS_TOP);
 		index++;
 		break;
 
@@ -956,6 +1010,7 @@ eval_func2:
 	case ET_LIT_WORD:
 		DS_PUSH(value);
 		VAL_SET(DS_TOP, REB_WORD);
+		if (VAL_GET_OPT(value, OPTS_SHARED)) Unshare_Value(DS_TOP);
 		index++;
 		break;
 
@@ -967,6 +1022,7 @@ eval_func2:
 	case ET_LIT_PATH:
 		DS_PUSH(value);
 		VAL_SET(DS_TOP, REB_PATH);
+		if (VAL_GET_OPT(value, OPTS_SHARED)) Unshare_Value(DS_TOP);
 		index++;
 		break;
 
@@ -1061,11 +1117,14 @@ eval_func2:
 
 /***********************************************************************
 **
-*/	REBFLG Try_Block(REBSER *block, REBCNT index)
+*/	REBFLG Try_Block(REBSER *block, REBCNT index, REBFLG discard)
 /*
 **		Evaluate a block from the index position specified in the value.
 **		TOS+1 holds the result.
 **
+**		If discard is set, the caller does not use the error, so errors
+**		within the block are thrown without their error object.
+**
 ***********************************************************************/
 {
 	REBOL_STATE state;
@@ -1081,6 +1140,7 @@ eval_func2:
 		return TRUE;
 	}
 	SET_STATE(state, Saved_State);
+	Discard_Errors = discard;
 
 	tos = 0;
 	while (index < BLK_LEN(block)) {
@@ -1100,41 +1160,108 @@ eval_func2:
 
 /***********************************************************************
 **
-*/	void Reduce_Block(REBSER *block, REBCNT index, REBVAL *into)
+*/	static REBSER *Push_Output(REBVAL *into, REBCNT size)
 /*
-**		Reduce block from the index position specified in the value.
-**		Collect all values from stack and make them a block.
+**		Push the output of the reduce and compose functions on the
+**		stack (which also keeps it safe from GC) and return its series.
+**
+**		Without INTO, it is a new block with room for size values.
+**		With INTO, results are appended directly to the INTO series,
+**		which is extended for size values up front, so no temporary
+**		block is made and a reused buffer is not reallocated. The
+**		pushed value holds the tail where the results start, and
+**		Finish_Output moves them to the INTO position.
 **
 ***********************************************************************/
 {
-	REBCNT len = 0;
-	REBSER *ser = NULL;
-	REBVAL blk;
-	enum REBOL_Types type;
+	REBSER *ser;
 
-	if (into != NULL) {
+	if (into) {
 		ser = VAL_SERIES(into);
-		type = VAL_TYPE(into);
-		len = VAL_INDEX(into) + SERIES_LEN(block) - index;
-	} else {
-		ser = Make_Block(SERIES_TAIL(block) - index);
-		if (ser == NULL)
-			Crash(RE_NO_MEMORY);
-		type = REB_BLOCK;
-		len = 0;
+		TRAP_PROTECT(ser);
+		if (SERIES_REST(ser) <= SERIES_TAIL(ser) + size) Extend_Series(ser, size);
+		DS_PUSH(into);
+		VAL_INDEX(DS_TOP) = SERIES_TAIL(ser);
+	}
+	else {
+		ser = Make_Block(size);
+		DS_PUSH_NONE;
+		Set_Block(DS_TOP, ser);
+	}
+
+	return ser;
+}
+
+
+/***********************************************************************
+**
+*/	static void Reverse_Values(REBVAL *value, REBCNT len)
+/*
+***********************************************************************/
+{
+	REBVAL *last = value + len - 1;
+	REBVAL tmp;
+
+	for (len /= 2; len > 0; len--) {
+		tmp = *value;
+		*value++ = *last;
+		*last-- = tmp;
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Finish_Output(REBVAL *into)
+/*
+**		Complete the output pushed by Push_Output. With INTO, the
+**		results appended at its tail are rotated in place to the
+**		INTO index, and TOS is set just past them (the result of
+**		the /into refinements). Nothing to do for a new block.
+**
+***********************************************************************/
+{
+	REBVAL *out = DS_TOP;
+	REBSER *ser = VAL_SERIES(out);
+	REBCNT tail = SERIES_TAIL(ser);
+	REBCNT start = VAL_INDEX(out);
+	REBCNT index;
+
+	if (!into) return;
+
+	index = VAL_INDEX(into);
+	if (start > tail) start = tail; // (series was modified while evaluating)
+	if (index > start) index = start;
+
+	if (index < start && start < tail) {
+		Reverse_Values(BLK_SKIP(ser, index), start - index);
+		Reverse_Values(BLK_SKIP(ser, start), tail - start);
+		Reverse_Values(BLK_SKIP(ser, index), tail - index);
 	}
 
-	VAL_SET(&blk, type);
-	VAL_SERIES(&blk) = ser;
-	VAL_INDEX(&blk) = len;
-	VAL_SERIES_SIDE(&blk) = 0;
-	DS_PUSH(&blk); //push here avoid the blk being GC'ed later
+	VAL_INDEX(out) = index + tail - start;
+}
+
+
+/***********************************************************************
+**
+*/	void Reduce_Block(REBSER *block, REBCNT index, REBVAL *into)
+/*
+**		Reduce block from the index position specified in the value.
+**		Results are appended to the output as they are evaluated.
+**		Returns the new block (or INTO position) on TOS.
+**
+***********************************************************************/
+{
+	REBSER *ser = Push_Output(into, SERIES_TAIL(block) - index);
 
 	while (index < BLK_LEN(block)) {
 		index = Do_Next(block, index, 0);
 		if (THROWN(DS_TOP)) return;
 		Append_Val(ser, DS_POP);
 	}
+
+	Finish_Output(into);
 }
 
 
@@ -1146,33 +1273,11 @@ eval_func2:
 **
 ***********************************************************************/
 {
-	REBINT start = DSP + 1;
 	REBVAL *val;
 	REBVAL *v;
 	REBSER *ser = 0;
 	REBCNT idx = 0;
-
-	REBCNT len = 0;
-	REBSER *dest_ser = NULL;
-	REBVAL blk;
-	enum REBOL_Types type;
-
-	if (into != NULL) {
-		dest_ser = VAL_SERIES(into);
-		type = VAL_TYPE(into);
-		len = VAL_INDEX(into) + SERIES_LEN(block) - index;
-	} else {
-		dest_ser = Make_Block(SERIES_LEN(block) - index);
-		if (dest_ser == NULL) Crash(RE_NO_MEMORY);
-		type = REB_BLOCK;
-		len = 0;
-	}
-
-	VAL_SET(&blk, type);
-	VAL_SERIES(&blk) = dest_ser;
-	VAL_INDEX(&blk) = len;
-	VAL_SERIES_SIDE(&blk) = 0;
-	DS_PUSH(&blk); //push here avoid the blk being GC'ed later
+	REBSER *dest_ser = Push_Output(into, SERIES_TAIL(block) - index);
 
 	if (IS_BLOCK(words)) {
 		ser = VAL_SERIES(words);
@@ -1208,6 +1313,8 @@ eval_func2:
 		// No need to check for unwinds (THROWN) here, because unwinds should
 		// never be accessible via words or paths.
 	}
+
+	Finish_Output(into);
 }
 
 
@@ -1217,28 +1324,8 @@ eval_func2:
 /*
 ***********************************************************************/
 {
-	REBCNT len = 0;
-	REBSER *ser = NULL;
-	REBVAL blk;
-	REBVAL *val = NULL;
-	enum REBOL_Types type;
-
-	if (into != NULL) {
-		ser = VAL_SERIES(into);
-		type = VAL_TYPE(into);
-		len = VAL_INDEX(into) + SERIES_LEN(block) - index;
-	} else {
-		ser = Make_Block(SERIES_LEN(block) - index);
-		if (ser == NULL) Crash(RE_NO_MEMORY);
-		type = REB_BLOCK;
-		len = 0;
-	}
-
-	VAL_SET(&blk, type);
-	VAL_SERIES(&blk) = ser;
-	VAL_INDEX(&blk) = len;
-	VAL_SERIES_SIDE(&blk) = 0;
-	DS_PUSH(&blk); //push here avoid the blk being GC'ed later
+	REBVAL *val;
+	REBSER *ser = Push_Output(into, SERIES_TAIL(block) - index);
 
 	while (index < BLK_LEN(block)) {
 		if (IS_SET_WORD(val = BLK_SKIP(block, index))) {
@@ -1250,6 +1337,7 @@ eval_func2:
 		Append_Val(ser, DS_POP);
 	}
 
+	Finish_Output(into);
 }
 
 
@@ -1326,48 +1414,24 @@ eval_func2:
 */	void Compose_Block(REBVAL *block, REBFLG deep, REBFLG only, REBVAL *into)
 /*
 **		Compose a block from a block of un-evaluated values and
-**		paren blocks that are evaluated. Stack holds temp values,
-**		which also protects them from GC along the way.
+**		paren blocks that are evaluated. Results are appended to the
+**		output as they are made (see Push_Output).
 **
 **			deep - recurse into sub-blocks
 **			only - parens that return blocks are kept as blocks
 **
-**		Returns result as a block on top of stack.
+**		Returns result as a block (or INTO position) on top of stack.
 **
 ***********************************************************************/
 {
 	REBVAL *value;
-	REBINT start = DSP + 1;
-	REBCNT len = 0;
-	REBINT needs_free = 0;
-	REBSER *ser = NULL;
-	REBVAL blk;
-	enum REBOL_Types type;
-
-	if (into != NULL) {
-		ser = VAL_SERIES(into);
-		type = VAL_TYPE(into);
-		len = VAL_INDEX(into) + VAL_BLK_LEN(block);
-	} else {
-		ser = Make_Block(VAL_BLK_LEN(block));
-		if (ser == NULL) Crash(RE_NO_MEMORY);
-		type = REB_BLOCK;
-		len = 0;
-		needs_free = 1;
-	}
-
-	VAL_SET(&blk, type);
-	VAL_SERIES(&blk) = ser;
-	VAL_INDEX(&blk) = len;
-	VAL_SERIES_SIDE(&blk) = 0;
-	DS_PUSH(&blk); //push here avoid the blk being GC'ed later
+	REBSER *ser = Push_Output(into, VAL_BLK_LEN(block));
 
 	for (value = VAL_BLK_DATA(block); NOT_END(value); value++) {
 		if (IS_PAREN(value)) {
 			// Eval the paren, and leave result on the stack:
 			REBVAL *paren = DO_BLK(value);
 			if (THROWN(paren)) {
-				if (needs_free) Free_Series(ser);
 				DSP ++;
 				return;
 			}
@@ -1396,6 +1460,7 @@ eval_func2:
 		}
 	}
 
+	Finish_Output(into);
 }
 
 
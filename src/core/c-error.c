@@ -99,7 +99,7 @@
 #include "sys-state.h"
 
 // Globals or Threaded???
-static REBOL_STATE Top_State; // Boot var: holds error state during boot
+static INSTANCE REBOL_STATE Top_State; // Boot var: holds error state during boot
 
 
 /***********************************************************************
@@ -448,13 +448,32 @@ static REBOL_STATE Top_State; // Boot var: holds error state during boot
 }
 
 
+/***********************************************************************
+**
+*/	static void Raise_Error(REBCNT num, REBVAL *arg1, REBVAL *arg2, REBVAL *arg3)
+/*
+**		Make the error and throw it. If the catcher discards errors
+**		(ATTEMPT), only the error number is thrown, so the error
+**		object and its backtrace are never made.
+**
+***********************************************************************/
+{
+	if (Discard_Errors && !Trace_Level) {
+		if (!Saved_State) Crash(RP_NO_SAVED_STATE);
+		SET_ERROR(TASK_THIS_ERROR, num, 0);
+		LONG_JUMP(*Saved_State, 1);
+	}
+	Throw_Error(Make_Error(num, arg1, arg2, arg3));
+}
+
+
 /***********************************************************************
 **
 */	void Trap0(REBCNT num)
 /*
 ***********************************************************************/
 {
-	Throw_Error(Make_Error(num, 0, 0, 0));
+	Raise_Error(num, 0, 0, 0);
 }
 
 
@@ -464,7 +483,7 @@ static REBOL_STATE Top_State; // Boot var: holds error state during boot
 /*
 ***********************************************************************/
 {
-	Throw_Error(Make_Error(num, arg1, 0, 0));
+	Raise_Error(num, arg1, 0, 0);
 }
 
 
@@ -474,7 +493,7 @@ static REBOL_STATE Top_State; // Boot var: holds error state during boot
 /*
 ***********************************************************************/
 {
-	Throw_Error(Make_Error(num, arg1, arg2, 0));
+	Raise_Error(num, arg1, arg2, 0);
 }
 
 
@@ -484,7 +503,7 @@ static REBOL_STATE Top_State; // Boot var: holds error state during boot
 /*
 ***********************************************************************/
 {
-	Throw_Error(Make_Error(num, arg1, arg2, arg3));
+	Raise_Error(num, arg1, arg2, arg3);
 }
 
 
@@ -452,10 +452,124 @@
 **      Clone old src_frame to new dst_frame knowing
 **		which types of values need to be copied, deep copied, and rebound.
 **
+**		Values still shared with a prototype are rebound when they
+**		are copied (see Unshare_Frame_Value).
+**
 ***********************************************************************/
 {
+	REBVAL *value;
+
 	// Rebind all values:
-	Rebind_Block(src_frame, dst_frame, BLK_SKIP(dst_frame, 1), REBIND_FUNC);
+	for (value = BLK_SKIP(dst_frame, 1); NOT_END(value); value++) {
+		if (!VAL_GET_OPT(value, OPTS_PROTO))
+			Rebind_Value(src_frame, dst_frame, value, REBIND_FUNC);
+	}
+}
+
+
+/***********************************************************************
+**
+*/  void Unshare_Frame_Value(REBSER *frame, REBCNT n)
+/*
+**		Give the frame its own copy of a value it still shares with
+**		its prototype: deep copied and rebound as MAKE would have
+**		done it. A prototype (its own parent) just copies the values
+**		it lent, so the objects made from it keep the originals.
+**
+***********************************************************************/
+{
+	REBSER *parent = FRM_PARENT(frame);
+
+	VAL_CLR_OPT(FRM_VALUE(frame, n), OPTS_PROTO);
+	Copy_Deep_Values(frame, n, n + 1, TS_CLONE);
+	if (parent && parent != frame)
+		Rebind_Value(parent, frame, FRM_VALUE(frame, n), REBIND_FUNC);
+}
+
+
+/***********************************************************************
+**
+*/  void Unshare_Frame(REBSER *frame)
+/*
+**		Copy all values the frame still shares with its prototype.
+**		Called before values of the frame are used in bulk.
+**
+***********************************************************************/
+{
+	REBVAL *value;
+	REBCNT n;
+
+	if (!FRM_PARENT(frame)) return;
+
+	for (n = 1, value = FRM_VALUE(frame, 1); NOT_END(value); n++, value++) {
+		if (VAL_GET_OPT(value, OPTS_PROTO)) Unshare_Frame_Value(frame, n);
+	}
+
+	// A prototype stays one, other objects now own all values:
+	if (FRM_PARENT(frame) != frame) FRM_PARENT(frame) = 0;
+}
+
+
+/***********************************************************************
+**
+*/  void Make_Prototype(REBSER *frame)
+/*
+**		Make the frame a prototype. It takes its own copy of the
+**		series it holds and flags them: only a flagged series can
+**		be lent, as nothing outside the frame refers to it. When
+**		the prototype uses a flagged value it copies it again (see
+**		Unshare_Frame_Value), and that value is no longer lent.
+**
+***********************************************************************/
+{
+	REBVAL *value;
+	REBCNT n;
+
+	FRM_PARENT(frame) = frame;
+
+	for (n = 1, value = FRM_VALUE(frame, 1); NOT_END(value); n++, value++) {
+		if ((TYPESET(VAL_TYPE(value)) & TS_CLONE & TS_SERIES) && !VAL_GET_OPT(value, OPTS_PROTO)) {
+			Copy_Deep_Values(frame, n, n + 1, TS_CLONE);
+			VAL_SET_OPT(value, OPTS_PROTO);
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/  static REBSER *Make_Shared_Object(REBSER *parent, REBVAL *block)
+/*
+**      Create an object from a prototype. The word list is reused
+**      when the spec adds no words, and the functions and flagged
+**      series of the prototype are not copied until they are used
+**      (see Unshare_Frame_Value). Other series may be referred to
+**      from elsewhere, so they are copied now as MAKE always did.
+**
+***********************************************************************/
+{
+	REBSER *words;
+	REBSER *object;
+	REBVAL *value;
+	REBVAL *val;
+	REBCNT n;
+
+	if (!block || IS_END(block)) words = FRM_WORD_SERIES(parent);
+	else words = Collect_Frame(BIND_ONLY, parent, block); // GC safe
+	object = Create_Frame(words, 0); // GC safe
+	FRM_PARENT(object) = parent;
+
+	value = FRM_VALUES(parent) + 1;
+	val = FRM_VALUES(object) + 1;
+	for (n = 1; NOT_END(value); n++, value++, val++) {
+		*val = *value;
+		if (TYPESET(VAL_TYPE(value)) & TS_CLONE & TS_FUNCLOS)
+			VAL_SET_OPT(val, OPTS_PROTO);
+		else if ((TYPESET(VAL_TYPE(value)) & TS_CLONE & TS_SERIES) && !VAL_GET_OPT(value, OPTS_PROTO))
+			Copy_Deep_Values(object, n, n + 1, TS_CLONE);
+	}
+
+	return object;
 }
 
 
@@ -473,6 +587,13 @@
 
 	PG_Reb_Stats->Objects++;
 
+	if (parent && FRM_PARENT(parent)) {
+		if (FRM_PARENT(parent) == parent)
+			return Make_Shared_Object(parent, block);
+		// Objects only share with their own prototype:
+		Unshare_Frame(parent);
+	}
+
 	if (!block || IS_END(block)) {
 		object = parent ? Copy_Block_Values(parent, 0, SERIES_TAIL(parent), TS_CLONE) : Make_Frame(0);
 	} else {
@@ -532,6 +653,8 @@
 	REBVAL *value;
 	REBCNT n;
 
+	Unshare_Frame(frame);
+
 	n = (mode & 4) ? 0 : 1;
 	block = Make_Block(SERIES_TAIL(frame) * (n + 1));
 
@@ -628,6 +751,9 @@
 	REBCNT n;
 	REBINT *binds = WORDS_HEAD(Bind_Table);
 
+	if (parent1) Unshare_Frame(parent1);
+	Unshare_Frame(parent2);
+
 	// Merge parent1 and parent2 words.
 	// Keep the binding table.
 	Collect_Start(BIND_ALL);
@@ -643,6 +769,7 @@
 	VAL_SET(value, REB_FRAME);
 	VAL_FRM_WORDS(value) = wrds;
 	VAL_FRM_SPEC(value) = 0;
+	VAL_FRM_PARENT(value) = 0;
 
 	// Copy parent1 values:
 	COPY_VALUES(FRM_VALUES(parent1)+1, FRM_VALUES(child)+1, SERIES_TAIL(parent1)-1);
@@ -694,6 +821,9 @@
 
 	if (IS_PROTECT_SERIES(target)) Trap0(RE_PROTECTED);
 
+	Unshare_Frame(target);
+	Unshare_Frame(source);
+
 	if (IS_INTEGER(only_words)) { // Must be: 0 < i <= tail
 		i = VAL_INT32(only_words); // never <= 0
 		if (i == 0) i = 1;
@@ -1027,19 +1157,30 @@
 **		modes must have REBIND_TYPE.
 **
 ***********************************************************************/
+{
+	for (; NOT_END(data); data++)
+		Rebind_Value(src_frame, dst_frame, data, modes);
+}
+
+
+/***********************************************************************
+**
+*/  void Rebind_Value(REBSER *src_frame, REBSER *dst_frame, REBVAL *data, REBFLG modes)
+/*
+**      Rebind a single value (deeply). See Rebind_Block.
+**
+***********************************************************************/
 {
 	REBINT *binds = WORDS_HEAD(Bind_Table);
 
-	for (; NOT_END(data); data++) {
-		if (ANY_BLOCK(data))
-			Rebind_Block(src_frame, dst_frame, VAL_BLK_DATA(data), modes);
-		else if (ANY_WORD(data) && VAL_WORD_FRAME(data) == src_frame) {
-			VAL_WORD_FRAME(data) = dst_frame;
-			if (modes & REBIND_TABLE) VAL_WORD_INDEX(data) = binds[VAL_WORD_CANON(data)];
-			if (modes & REBIND_TYPE) VAL_WORD_INDEX(data) = - VAL_WORD_INDEX(data);
-		} else if ((modes & REBIND_FUNC) && (IS_FUNCTION(data) || IS_CLOSURE(data)))
-			Rebind_Block(src_frame, dst_frame, BLK_HEAD(VAL_FUNC_BODY(data)), modes);
-	}
+	if (ANY_BLOCK(data))
+		Rebind_Block(src_frame, dst_frame, VAL_BLK_DATA(data), modes);
+	else if (ANY_WORD(data) && VAL_WORD_FRAME(data) == src_frame) {
+		VAL_WORD_FRAME(data) = dst_frame;
+		if (modes & REBIND_TABLE) VAL_WORD_INDEX(data) = binds[VAL_WORD_CANON(data)];
+		if (modes & REBIND_TYPE) VAL_WORD_INDEX(data) = - VAL_WORD_INDEX(data);
+	} else if ((modes & REBIND_FUNC) && (IS_FUNCTION(data) || IS_CLOSURE(data)))
+		Rebind_Block(src_frame, dst_frame, BLK_HEAD(VAL_FUNC_BODY(data)), modes);
 }
 
 
@@ -1093,6 +1234,37 @@
 }
 
 
+#ifdef HAS_SHAPE_CACHE
+/***********************************************************************
+**
+*/  REBCNT Find_Word_Slot(REBSER *frame, REBVAL *word)
+/*
+**      Find_Word_Index for a path selector word. Objects made from
+**      the same word list (see Collect_End) share their layout, so
+**      the word caches the list and index it last found, and only
+**      searches again when used on an object of another layout.
+**      The cached index is checked, so a stale cache is harmless.
+**
+***********************************************************************/
+{
+	REBSER *words = FRM_WORD_SERIES(frame);
+	REBCNT n = VAL_WORD_SLOT(word);
+	REBVAL *spec;
+
+	if (VAL_WORD_SHAPE(word) == words && n > 0 && n < SERIES_TAIL(words)) {
+		spec = BLK_SKIP(words, n);
+		if ((VAL_WORD_SYM(word) == VAL_BIND_SYM(spec) || VAL_WORD_CANON(word) == VAL_BIND_CANON(spec))
+			&& !VAL_GET_OPT(spec, OPTS_HIDE)) return n;
+	}
+
+	n = Find_Word_Index(frame, VAL_WORD_SYM(word), FALSE);
+	VAL_WORD_SHAPE(word) = words;
+	VAL_WORD_SLOT(word) = n;
+	return n;
+}
+#endif
+
+
 /***********************************************************************
 **
 */  REBVAL *Find_Word_Value(REBSER *frame, REBCNT sym)
@@ -1108,6 +1280,7 @@
 	if (!frame) return 0;
 	n = Find_Word_Index(frame, sym, FALSE);
 	if (!n) return 0;
+	if (VAL_GET_OPT(FRM_VALUE(frame, n), OPTS_PROTO)) Unshare_Frame_Value(frame, n);
 	return BLK_SKIP(frame, n);
 }
 
@@ -1176,7 +1349,11 @@
 	REBINT dsf;
 
 	if (!frame) Trap1(RE_NOT_DEFINED, word);
-	if (index >= 0) return FRM_VALUES(frame)+index;
+	if (index > 0) {
+		if (VAL_GET_OPT(FRM_VALUE(frame, index), OPTS_PROTO)) Unshare_Frame_Value(frame, index);
+		return FRM_VALUES(frame)+index;
+	}
+	if (index == 0) return FRM_VALUES(frame);
 
 	// A negative index indicates that the value is in a frame on
 	// the data stack, so now we must find it by walking back the
@@ -1187,7 +1364,7 @@
 		if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
 	}
 //	if (Trace_Level) Dump_Stack_Frame(dsf);
-	return DSF_ARGS(dsf, -index);
+	return DSF_VAR(dsf, -index);
 }
 
 
@@ -1208,6 +1385,7 @@
 	if (index >= 0) {
 		if (VAL_PROTECTED(FRM_WORDS(frame) + index))
 			Trap1(RE_LOCKED_WORD, word);
+		if (index && VAL_GET_OPT(FRM_VALUE(frame, index), OPTS_PROTO)) Unshare_Frame_Value(frame, index);
 		return FRM_VALUES(frame) + index;
 	}
 
@@ -1220,7 +1398,7 @@
 		if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
 	}
 //	if (Trace_Level) Dump_Stack_Frame(dsf);
-	return DSF_ARGS(dsf, -index);
+	return DSF_VAR(dsf, -index);
 }
 
 
@@ -1237,13 +1415,16 @@
 	REBINT dsf;
 
 	if (!frame) return 0;
-	if (index >= 0) return FRM_VALUES(frame)+index;
+	if (index >= 0) {
+		if (index && VAL_GET_OPT(FRM_VALUE(frame, index), OPTS_PROTO)) Unshare_Frame_Value(frame, index);
+		return FRM_VALUES(frame)+index;
+	}
 	dsf = DSF;
 	while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
 		dsf = PRIOR_DSF(dsf);
 		if (dsf <= 0) return 0;
 	}
-	return DSF_ARGS(dsf, -index);
+	return DSF_VAR(dsf, -index);
 }
 
 
@@ -1301,7 +1482,7 @@
 		dsf = PRIOR_DSF(dsf);
 		if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
 	}
-	*DSF_ARGS(dsf, -index) = *value;
+	*DSF_VAR(dsf, -index) = *value;
 }
 
 
@@ -1367,6 +1548,7 @@
 	REBSER *obj = VAL_OBJ_FRAME(value);
 
 	if (index >= SERIES_TAIL(obj)) return 0;
+	if (index && VAL_GET_OPT(BLK_SKIP(obj, index), OPTS_PROTO)) Unshare_Frame_Value(obj, index);
 	return BLK_SKIP(obj, index);
 }
 
@@ -156,10 +156,158 @@
 		}
 	}
 
+	// Describe the args before the first refinement for Do_Args:
+	for (n = 0, value = BLK_SKIP(words, 1); IS_WORD(value); value++) n++;
+	if (n <= 0xff && (IS_END(value) || IS_REFINEMENT(value)))
+		VAL_BIND_TYPESET(BLK_HEAD(words)) = FUNC_DESC_FIXED | n;
+
 	return words; //Create_Frame(words, 0);
 }
 
 
+/***********************************************************************
+**
+*/	static void Share_Body(REBSER *block)
+/*
+**		Flag the literals of a closure body. The body is shared by
+**		all calls of the closure, so these values must be copied
+**		(see Unshare_Value) before they can escape from a call.
+**
+***********************************************************************/
+{
+	REBVAL *value;
+
+	for (value = BLK_HEAD(block); NOT_END(value); value++) {
+		if (ANY_BLOCK(value)) {
+			VAL_SET_OPT(value, OPTS_SHARED);
+			Share_Body(VAL_SERIES(value));
+		}
+		else if (ANY_BINSTR(value)
+			|| (ANY_WORD(value) && VAL_WORD_INDEX(value) < 0))
+			VAL_SET_OPT(value, OPTS_SHARED);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	void Unshare_Block(REBSER *block, REBSER *words, REBSER *frame)
+/*
+**		Clear the shared flags of a copied closure body block, and
+**		move the words relative to the words list to the frame.
+**		Words can be zero to only clear the flags.
+**
+***********************************************************************/
+{
+	REBVAL *value;
+
+	for (value = BLK_HEAD(block); NOT_END(value); value++) {
+		VAL_CLR_OPT(value, OPTS_SHARED);
+		if (ANY_BLOCK(value))
+			Unshare_Block(VAL_SERIES(value), words, frame);
+		else if (words && ANY_WORD(value) && VAL_WORD_FRAME(value) == words) {
+			VAL_WORD_FRAME(value) = frame;
+			VAL_WORD_INDEX(value) = -VAL_WORD_INDEX(value);
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	void Drop_Unshared(REBINT dsf, REBSER *frame)
+/*
+**		GC_Unshared holds the copies made by Unshare_Value as
+**		entries of four: the stack frame and closure frame of the
+**		call, the literal series and its copy. Entries are kept in
+**		stack order. Drop those of calls at dsf and above, except
+**		the ones of the given frame (zero to drop them all).
+**		Calls that ended by an error leave entries behind too.
+**
+***********************************************************************/
+{
+	REBSER **sp = (REBSER **)GC_Unshared->data;
+	REBCNT n = SERIES_TAIL(GC_Unshared);
+
+	for (; n > 0; n -= 4) {
+		if ((REBINT)(REBUPT)sp[n-4] < dsf) break;
+		if ((REBINT)(REBUPT)sp[n-4] == dsf && sp[n-3] == frame) break;
+	}
+	SERIES_TAIL(GC_Unshared) = n;
+}
+
+
+/***********************************************************************
+**
+*/	void Unshare_Value(REBVAL *value)
+/*
+**		A literal of a shared closure body is about to be kept by
+**		the code being evaluated. Give it a copy of its own (blocks
+**		deeply) with the words bound to the frame of the running
+**		closure, exactly as if the body had been cloned for the call.
+**
+**		The copy is made once per call, so a literal evaluated again
+**		in the same call (in a loop, say) is the same series.
+**
+***********************************************************************/
+{
+	REBSER *words = 0;
+	REBSER *frame = 0;
+	REBSER *series;
+	REBSER **sp;
+	REBINT dsf;
+	REBCNT n;
+
+	VAL_CLR_OPT(value, OPTS_SHARED);
+
+	// The innermost closure on the stack is the one running the body:
+	for (dsf = DSF; dsf > 0; dsf = PRIOR_DSF(dsf)) {
+		if (IS_CLOSURE(DSF_FUNC(dsf))) {
+			words = VAL_FUNC_ARGS(DSF_FUNC(dsf));
+			frame = VAL_OBJ_FRAME(DSF_RETURN(dsf));
+			break;
+		}
+	}
+
+	if (ANY_WORD(value)) {
+		if (words && VAL_WORD_FRAME(value) == words) {
+			VAL_WORD_FRAME(value) = frame;
+			VAL_WORD_INDEX(value) = -VAL_WORD_INDEX(value);
+		}
+		return;
+	}
+
+	// Has the call copied it already?
+	if (frame) {
+		Drop_Unshared(dsf, frame);
+		sp = (REBSER **)GC_Unshared->data;
+		for (n = SERIES_TAIL(GC_Unshared); n > 0 && sp[n-3] == frame; n -= 4) {
+			if (sp[n-2] == VAL_SERIES(value)) {
+				VAL_SERIES(value) = sp[n-1];
+				return;
+			}
+		}
+	}
+
+	series = VAL_SERIES(value);
+	if (ANY_BLOCK(value)) {
+		VAL_SERIES(value) = Copy_Block_Values(series, 0, VAL_TAIL(value), TS_CODE);
+		Unshare_Block(VAL_SERIES(value), words, frame);
+	}
+	else
+		VAL_SERIES(value) = Copy_Series(series);
+
+	if (frame) {
+		if (SERIES_REST(GC_Unshared) < SERIES_TAIL(GC_Unshared) + 5) Extend_Series(GC_Unshared, 16);
+		sp = (REBSER **)GC_Unshared->data;
+		sp[GC_Unshared->tail++] = (REBSER *)(REBUPT)dsf;
+		sp[GC_Unshared->tail++] = frame;
+		sp[GC_Unshared->tail++] = series;
+		sp[GC_Unshared->tail++] = VAL_SERIES(value);
+	}
+}
+
+
 /***********************************************************************
 **
 */	void Make_Native(REBVAL *value, REBSER *spec, REBFUN func, REBINT type)
@@ -207,6 +355,8 @@
 	if (type == REB_FUNCTION || type == REB_CLOSURE)
 		Bind_Relative(VAL_FUNC_ARGS(value), VAL_FUNC_ARGS(value), VAL_FUNC_BODY(value));
 
+	if (type == REB_CLOSURE) Share_Body(VAL_FUNC_BODY(value));
+
 	return TRUE;
 }
 
@@ -250,6 +400,8 @@
 	if (IS_FUNCTION(value) || IS_CLOSURE(value))
 		Bind_Relative(VAL_FUNC_ARGS(value), VAL_FUNC_ARGS(value), VAL_FUNC_BODY(value));
 
+	if (IS_CLOSURE(value)) Share_Body(VAL_FUNC_BODY(value));
+
 	return TRUE;
 }
 
@@ -431,12 +583,16 @@
 **
 */	void Do_Closure(REBVAL *func)
 /*
-**		Do a closure by cloning its body and rebinding it to
-**		a new frame of words/values.
+**		Do a closure by evaluating its shared body with a new
+**		frame of words/values.
+**
+**		The body is not cloned. Its words stay relative and are
+**		found in the frame kept in the return slot of the call
+**		(see DSF_VAR). Literals that escape from the body are
+**		copied and bound to the frame by Unshare_Value.
 **
 ***********************************************************************/
 {
-	REBSER *body;
 	REBSER *frame;
 	REBVAL *result;
 	REBVAL *ds;
@@ -444,20 +600,15 @@
 	Eval_Functions++;
 	//DISABLE_GC;
 
-	// Clone the body of the function to allow rebinding to it:
-	body = Clone_Block(VAL_FUNC_BODY(func));
-
 	// Copy stack frame args as the closure object (one extra at head)
 	frame = Copy_Values(BLK_SKIP(DS_Series, DS_ARG_BASE), SERIES_TAIL(VAL_FUNC_ARGS(func)));
 	SET_FRAME(BLK_HEAD(frame), 0, VAL_FUNC_ARGS(func));
 
-	// Rebind the body to the new context (deeply):
-	Rebind_Block(VAL_FUNC_ARGS(func), frame, BLK_HEAD(body), REBIND_TYPE);
-
 	ds = DS_RETURN;
-	SET_OBJECT(ds, body); // keep it GC safe
-	result = Do_Blk(body, 0); // GC-OK - also, result returned on DS stack
+	SET_OBJECT(ds, frame); // keep it GC safe, and findable from the stack
+	result = Do_Blk(VAL_FUNC_BODY(func), 0); // GC-OK - also, result returned on DS stack
 	ds = DS_RETURN;
+	if (SERIES_TAIL(GC_Unshared)) Drop_Unshared(DSF, 0);
 
 	if (IS_ERROR(result) && IS_RETURN(result)) {
 		// Value below is kept safe from GC because no-allocation is
@@ -477,6 +628,5 @@
  */
 {
 	//RL_Print("%s, %d\n", __func__, __LINE__);
-	REBSER *args = Copy_Values(BLK_SKIP(DS_Series, DS_ARG_BASE + 1), SERIES_TAIL(VAL_FUNC_ARGS(routine)) - 1);
-	Call_Routine(routine, args, DS_RETURN);
+	Call_Routine(routine, DS_ARG(1), DS_RETURN);
 }
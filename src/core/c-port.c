@@ -31,7 +31,8 @@
 
 #include "sys-core.h"
 
-#define MAX_WAIT_MS 64 // Maximum millsec to sleep
+#define MAX_WAIT_MS 64 // Maximum millsec to sleep (between device polls)
+#define EVENTS_BATCH 32 // Maximum events dispatched per awake (avoids polling lockout)
 
 /***********************************************************************
 **
@@ -135,10 +136,45 @@
 }
 
 
+/***********************************************************************
+**
+*/	REBFLG Wake_Port(REBSER *port, REBVAL *event)
+/*
+**		Update a port after an event (for native actors) and call
+**		its AWAKE function. Returns TRUE if the port is awake.
+**
+**		Must be called from the frame of WAKE-UP (or one with the
+**		same [port event] args), as native actors use that frame.
+**
+***********************************************************************/
+{
+	REBVAL *val;
+
+	if (SERIES_TAIL(port) < STD_PORT_MAX) Crash(9910);
+
+	val = OFV(port, STD_PORT_ACTOR);
+	if (IS_NATIVE(val)) {
+		Do_Port_Action(port, A_UPDATE); // uses current stack frame
+	}
+
+	val = OFV(port, STD_PORT_AWAKE);
+	if (ANY_FUNC(val)) {
+		val = Apply_Func(0, val, event, 0);
+		if (!(IS_LOGIC(val) && VAL_LOGIC(val))) return FALSE;
+	}
+	return TRUE;  // wake it up
+}
+
+
 /***********************************************************************
 **
 */	REBINT Awake_System(REBSER *ports, REBINT only)
 /*
+**		Dispatch the queued events of the system port to the AWAKE
+**		functions of their ports, up to EVENTS_BATCH at a time.
+**		Ports that wake up are added to the wake list (port/data).
+**		With ONLY, just the events for the given ports are taken.
+**
 **	Returns:
 **		-1 for errors
 **		 0 for nothing to do
@@ -149,10 +185,13 @@
 	REBVAL *port;
 	REBVAL *state;
 	REBVAL *waked;
-	REBVAL *awake;
-	REBVAL tmp;
-	REBVAL ref_only;
-	REBVAL *v;
+	REBVAL *event;
+	REBVAL *target;
+	REBVAL *wake;
+	REBVAL evt;
+	REBVAL tgt;
+	REBINT count;
+	REBINT dsp;
 
 	// Get the system port object:
 	port = Get_System(SYS_PORTS, PORTS_SYSTEM);
@@ -170,30 +209,65 @@
 	// If there is nothing new to do, return now:
 	if (VAL_TAIL(state) == 0 && VAL_TAIL(waked) == 0) return -1;
 
-	//Debug_Num("A", VAL_TAIL(waked));
-	// Get the system port AWAKE function:
-	awake = VAL_BLK_SKIP(port, STD_PORT_AWAKE);
-	if (!ANY_FUNC(awake)) return -1;
-	if (ports) Set_Block(&tmp, ports);
-	else SET_NONE(&tmp);
+	// Short cut for a pause:
+	if (only && !ports) return -1;
+
+	DS_PUSH_NONE; // the event being dispatched
+	DS_PUSH_NONE; // its port
+	dsp = DSP;
+
+	for (count = 0; count < EVENTS_BATCH; count++) {
+		// Find the next event (for one of the given ports, if ONLY):
+		target = DS_VALUE(dsp); // (stack may move)
+		state = VAL_BLK_SKIP(port, STD_PORT_STATE); // (queue may move)
+		for (event = VAL_BLK(state); NOT_END(event); event++) {
+			if (!Get_Event_Var(event, SYM_PORT, target)) SET_NONE(target);
+			if (!only || Find_Block_Simple(ports, 0, target) < SERIES_TAIL(ports)) break;
+		}
+		if (IS_END(event)) break;
+
+		// Dequeue it first, as the port awake may WAIT again:
+		target[-1] = *event;
+		Remove_Series(VAL_SERIES(state), event - VAL_BLK(state), 1);
+
+		if (!IS_PORT(target)) continue; // no port to wake
+
+		// Call WAKE-UP, so the port actor runs in its frame:
+		evt = target[-1]; // (stack may move)
+		tgt = *target;
+		wake = Find_Word_Value(Lib_Context, SYM_WAKE_UP);
+		wake = Apply_Func(0, wake, &tgt, &evt, 0);
+		if (IS_LOGIC(wake) && VAL_LOGIC(wake)) {
+			// Add port to wake list:
+			target = DS_VALUE(dsp);
+			waked = VAL_BLK_SKIP(port, STD_PORT_DATA);
+			if (Find_Block_Simple(VAL_SERIES(waked), 0, target) == VAL_TAIL(waked))
+				Append_Val(VAL_SERIES(waked), target);
+		}
+	}
+
+	DSP = dsp - 2;
+
+	// No wake ports (just a timer), return now:
+	if (!ports) return -1;
 
-	if (only) SET_TRUE(&ref_only);
-	else SET_NONE(&ref_only);
-	// Call the system awake function:
-	v = Apply_Func(0, awake, port, &tmp, &ref_only, 0); // ds is return value
+	// Are any of the requested ports awake?
+	waked = VAL_BLK_SKIP(port, STD_PORT_DATA);
+	for (event = BLK_HEAD(ports); NOT_END(event); event++) {
+		if (Find_Block_Simple(VAL_SERIES(waked), 0, event) < VAL_TAIL(waked)) return 1;
+	}
 
-	// Awake function returns 1 for end of WAIT:
-	return IS_NONE(v) ? -1 : (IS_LOGIC(v) && VAL_LOGIC(v)) ? 1 : 0;
+	return count ? 0 : -1; // keep waiting, or events are ignored
 }
 
 
 /***********************************************************************
 **
-*/	REBINT Wait_Ports(REBSER *ports, REBCNT timeout, REBINT only)
+*/	REBINT Wait_Ports(REBSER *ports, REBI64 timeout, REBINT only)
 /*
 **	Inputs:
 **		Ports: a block of ports or zero (on stack to avoid GC).
-**		Timeout: milliseconds to wait
+**		Timeout: microseconds to wait, or -1 for no timeout
 **
 **	Returns:
 **		TRUE when port action happened, or FALSE for timeout.
@@ -201,19 +275,20 @@
 ***********************************************************************/
 {
 	REBI64 base = OS_DELTA_TIME(0, 0);
-	REBCNT time;
+	REBI64 time;
+	REBI64 wait;
 	REBINT result;
 	REBCNT wt = 1;
-	REBCNT res = (timeout >= 1000) ? 0 : 16;  // OS dependent?
-	REBCNT old_time = -1;
 
-	while (wt) {
-		if (GET_SIGNAL(SIG_ESCAPE)) {
+	while (TRUE) {
+		if (Eval_Escape || GET_SIGNAL(SIG_ESCAPE)) {
+			Eval_Escape = 0;
 			CLR_SIGNAL(SIG_ESCAPE);
 			Halt_Code(RE_HALT, 0); // Throws!
 		}
 
-		// Process any waiting events:
+		// Fire due timers, then process any waiting events:
+		Expire_Timers();
 		if ((result = Awake_System(ports, only)) > 0) return TRUE;
 
 		// If activity, use low wait time, otherwise increase it:
@@ -222,27 +297,23 @@
 			wt *= 2;
 			if (wt > MAX_WAIT_MS) wt = MAX_WAIT_MS;
 		}
+		wait = wt * 1000;
 
-		if (timeout != ALL_BITS) {
+		if (timeout >= 0) {
 			// Figure out how long that (and OS_WAIT) took:
-			time = (REBCNT)(OS_DELTA_TIME(base, 0)/1000);
-			if (time >= timeout) break;	  // done (was dt = 0 before)
-			else if (wt > timeout - time) // use smaller residual time
-				wt = timeout - time;
-
-			if (old_time >= 0
-				&& time - old_time < res) {
-				res = time - old_time;
-			}
-
-			old_time = time;
+			time = OS_DELTA_TIME(base, 0);
+			if (time >= timeout) break;	  // done
+			else if (wait > timeout - time) // use smaller residual time
+				wait = timeout - time;
 		}
 
-		//printf("%d %d %d\n", dt, time, timeout);
+		// Wake for the next timer (devices still need polling):
+		time = Next_Timer();
+		if (time >= 0 && time < wait) wait = time;
 
-		// Wait for events or time to expire:
-		//Debug_Num("OSW", wt);
-		OS_WAIT(wt, res);
+		// Wait for events or time to expire. A backlogged queue
+		// is dispatched before devices are polled for more:
+		if (result != 0 || !Event_Backlog()) OS_WAIT((REBCNT)wait, 0);
 	}
 
 	//time = (REBCNT)OS_DELTA_TIME(base, 0);
@@ -508,11 +579,7 @@ xx*/	REBINT Wait_Device(REBREQ *req, REBCNT timeout)
 **
 ***********************************************************************/
 
-#ifdef HAS_POSIX_SIGNAL
-#define MAX_SCHEMES 12		// max native schemes
-#else
-#define MAX_SCHEMES 11		// max native schemes
-#endif
+#define MAX_SCHEMES 14		// max native schemes
 
 typedef struct rebol_scheme_actions {
 	REBCNT sym;
@@ -520,7 +587,7 @@ typedef struct rebol_scheme_actions {
 	REBPAF fun;
 } SCHEME_ACTIONS;
 
-SCHEME_ACTIONS *Scheme_Actions;	// Initial Global (not threaded)
+INSTANCE SCHEME_ACTIONS *Scheme_Actions;	// Initial Global (not threaded)
 
 
 /***********************************************************************
@@ -627,6 +694,7 @@ SCHEME_ACTIONS *Scheme_Actions;	// Initial Global (not threaded)
 	Init_TCP_Scheme();
 	Init_UDP_Scheme();
 	Init_DNS_Scheme();
+	Init_Timer_Scheme();
 #ifndef MIN_OS
 	Init_Clipboard_Scheme();
 #endif
@@ -634,4 +702,33 @@ SCHEME_ACTIONS *Scheme_Actions;	// Initial Global (not threaded)
 #ifdef HAS_POSIX_SIGNAL
 	Init_Signal_Scheme();
 #endif
+#ifdef HAS_POSIX_PROCESS
+	Init_Process_Scheme();
+#endif
+}
+
+
+/***********************************************************************
+**
+*/	void Dispose_Ports(void)
+/*
+***********************************************************************/
+{
+	REBDEV **devices;
+	REBDEV *dev;
+	REBINT d;
+
+	Dispose_Event_Scheme();
+	Dispose_Timer_Scheme();
+
+	// Requests of ports left open point into memory that is about
+	// to be freed, so take them off the device pending lists:
+	devices = OS_DEVICES(); // pending lists of this thread
+	for (d = 0; d < RDI_MAX; d++) {
+		dev = devices[d];
+		if (dev) while (dev->pending) OS_ABORT_DEVICE(dev->pending);
+	}
+
+	Free_Mem(Scheme_Actions, sizeof(SCHEME_ACTIONS) * MAX_SCHEMES);
+	Scheme_Actions = 0;
 }
@@ -38,7 +38,7 @@
 
 #include "sys-core.h"
 
-static REBREQ *Req_SIO;
+static INSTANCE REBREQ *Req_SIO;
 
 
 /***********************************************************************
@@ -63,6 +63,20 @@ static REBREQ *Req_SIO;
 }
 
 
+/***********************************************************************
+**
+*/	void Dispose_StdIO(void)
+/*
+**		Free the request made by Init_StdIO. The device itself is
+**		owned by the host and stays open.
+**
+***********************************************************************/
+{
+	OS_FREE(Req_SIO);
+	Req_SIO = 0;
+}
+
+
 /***********************************************************************
 **
 */	static void Print_OS_Line(void)
@@ -511,7 +525,7 @@ static REBREQ *Req_SIO;
 **
 ***********************************************************************/
 {
-	static REBYTE buffer[256];
+	static INSTANCE REBYTE buffer[256];
 	REBINT res;
 
 	Req_SIO->data = buffer;
@@ -35,6 +35,13 @@
 **    Functions may be inlined (especially the ones marked by INLINE).
 **    64-bit and/or double arithmetic used where they bring advantage.
 **
+**    Where the compiler has a 128-bit integer type (DECI_128), add,
+**    multiply and string conversion take fast paths for the
+**    common exact cases (operands of the same or close exponents,
+**    products that need no rounding). Anything that needs rounding or
+**    normalization falls through to the limb loops, so results are
+**    identical either way.
+**
 ***********************************************************************/
 
 #include "sys-core.h"
@@ -53,6 +60,23 @@
 #define two_to_32 4294967296.0
 #define two_to_32l 4294967296.0l
 
+#if defined(__SIZEOF_INT128__) && !defined(TEST_MODE)
+#define DECI_128
+typedef unsigned __int128 REBU128;
+
+/* significand of a deci as a 128-bit integer */
+#define M128(d) (((REBU128)(d).m2 << 64) | ((REBU128)(d).m1 << 32) | (REBU128)(d).m0)
+
+/* powers of ten from the P table below */
+#define P128(i) (((REBU128)P[i][2] << 64) | ((REBU128)P[i][1] << 32) | (REBU128)P[i][0])
+
+/* 1e26 */
+#define P26_128 (((REBU128)5421010u << 64) | ((REBU128)3704098002u << 32) | (REBU128)3825205248u)
+
+/* stores 128-bit significand m (< 1e26) into deci d */
+#define SET_M128(d, m) ((d).m0 = (REBCNT)(m), (d).m1 = (REBCNT)((m) >> 32), (d).m2 = (REBCNT)((m) >> 64))
+#endif
+
 /* useful deci constants */
 static const deci deci_zero = {0u, 0u, 0u, 0u, 0};
 static const deci deci_one = {1u, 0u, 0u, 0u, 0};
@@ -432,7 +456,42 @@ REBFLG deci_is_lesser_or_equal (deci a, deci b) {
 	return a.s ? (m_cmp (3, sa, sb) >= 0) : (m_cmp (3, sa, sb) <= 0); 
 }
 
-deci deci_add (deci a, deci b) {
+#ifdef DECI_128
+/*
+	Exact-scale fast path of deci_add: aligns the operand with the larger
+	exponent if it stays below 1e26 (make_comparable does the same then);
+	returns FALSE when the general code is needed;
+*/
+INLINE REBFLG add_128 (deci *c, deci a, deci b) {
+	REBU128 x = M128(a), y = M128(b), z;
+	REBINT e = a.e;
+
+	if (a.e > b.e) {
+		if (a.e - b.e > 26 || x >= P128(26 - (a.e - b.e))) return FALSE;
+		x *= P128(a.e - b.e);
+		e = b.e;
+	} else if (b.e > a.e) {
+		if (b.e - a.e > 26 || y >= P128(26 - (b.e - a.e))) return FALSE;
+		y *= P128(b.e - a.e);
+	}
+	if (a.s == b.s) {
+		z = x + y;
+		if (z >= P26_128) return FALSE;
+		c->s = a.s;
+	} else if (x >= y) {
+		z = x - y;
+		c->s = a.s;
+	} else {
+		z = y - x;
+		c->s = b.s;
+	}
+	SET_M128(*c, z);
+	c->e = e;
+	return TRUE;
+}
+#endif
+
+static deci add_general (deci a, deci b) {
 	deci c;
 	REBCNT sc[4];
 	REBINT ea = a.e, eb = b.e, ta, tb, tc, test;
@@ -483,6 +542,14 @@ deci deci_add (deci a, deci b) {
 	return c;
 }
 
+deci deci_add (deci a, deci b) {
+#ifdef DECI_128
+	deci c;
+	if (add_128 (&c, a, b)) return c;
+#endif
+	return add_general (a, b);
+}
+
 deci deci_subtract (deci a, deci b) {return deci_add (a, deci_negate (b));}
 
 /* using 64-bit arithmetic */
@@ -883,6 +950,25 @@ deci deci_half_floor (deci a, deci b) {
 	denormalize
 }
 
+#ifdef DECI_128
+/*
+	Fast path of deci_multiply for 64-bit significands whose product
+	needs no rounding; c->s is already set;
+*/
+INLINE REBFLG multiply_128 (deci *c, const deci a, const deci b) {
+	REBU128 z;
+	REBINT e;
+
+	if (a.m2 || b.m2) return FALSE;
+	z = (REBU128)(((REBU64)a.m1 << 32) | a.m0) * (((REBU64)b.m1 << 32) | b.m0);
+	e = a.e + b.e;
+	if (z >= P26_128 || e < -128 || e > 127) return FALSE;
+	SET_M128(*c, z);
+	c->e = z ? e : 0;
+	return TRUE;
+}
+#endif
+
 deci deci_multiply (const deci a, const deci b) {
 	deci c;
 	REBCNT sa[] = {a.m0, a.m1, a.m2}, sb[] = {b.m0, b.m1, b.m2}, sc[7];
@@ -890,6 +976,10 @@ deci deci_multiply (const deci a, const deci b) {
 	
 	/* compute the sign */
 	c.s = (!a.s && b.s) || (a.s && !b.s);
+
+#ifdef DECI_128
+	if (multiply_128 (&c, a, b)) return c;
+#endif
 	
 	/* multiply sa by sb yielding "double significand" sc */
 	m_multiply (sc, 3, sa, 3, sb);
@@ -1057,11 +1147,28 @@ INLINE REBINT m_to_string (REBYTE *s, REBINT n, const REBCNT a[]) {
     	return 1;
 	}
 	
-    /* copy a to preserve it */
-	memcpy (b, a, n * sizeof (REBCNT));
-	
 	k = vmax = v + 10 * MAX_NB;
 	*k = '\0';
+
+#ifdef DECI_128
+	if (n <= 3) {
+		/* peel off 19 digits at a time, then use 64-bit division */
+		REBU128 x = ((REBU128)(n > 2 ? a[2] : 0) << 64) | ((REBU128)(n > 1 ? a[1] : 0) << 32) | a[0];
+		REBU64 y, e19 = U64_C(10000000000000000000);
+		REBINT i;
+		while (x >> 64) {
+			y = (REBU64)(x % e19);
+			x /= e19;
+			for (i = 0; i < 19; i++, y /= 10) *--k = '0' + (REBYTE)(y % 10);
+		}
+		for (y = (REBU64)x; y; y /= 10) *--k = '0' + (REBYTE)(y % 10);
+		strcpy(s, k);
+		return vmax - k;
+	}
+#endif
+
+    /* copy a to preserve it */
+	memcpy (b, a, n * sizeof (REBCNT));
     while (n > 0) {
     	r = m_divide_1 (n, b, b, 10u);
 		if (b[n - 1] == 0) n--;
@@ -226,6 +226,11 @@ extern void *MALLOC(size_t);
 #define MALLOC malloc
 #endif
 
+#ifdef INSTANCES
+// The private pool is shared by all threads; use malloc instead:
+#define Omit_Private_Memory
+#endif
+
 #ifndef Omit_Private_Memory
 #ifndef PRIVATE_MEM
 #define PRIVATE_MEM 2304
@@ -543,7 +548,7 @@ Bigint {
 
  typedef struct Bigint Bigint;
 
- static Bigint *freelist[Kmax+1];
+ static INSTANCE Bigint *freelist[Kmax+1];
 
  static Bigint *
 Balloc
@@ -916,7 +921,7 @@ mult
 	return c;
 	}
 
- static Bigint *p5s;
+ static INSTANCE Bigint *p5s;
 
  static Bigint *
 pow5mult
@@ -3562,7 +3567,7 @@ strtod
 	}
 
 #ifndef MULTIPLE_THREADS
- static char *dtoa_result;
+ static INSTANCE char *dtoa_result;
 #endif
 
  static char *
@@ -62,8 +62,8 @@ extern const REBDOF Func_Dispatch[];
 
 // !!!! The list below should not be hardcoded, but until someone
 // needs a lot of extensions, it will do fine.
-REBEXT Ext_List[64];
-REBCNT Ext_Next = 0;
+INSTANCE REBEXT Ext_List[64];
+INSTANCE REBCNT Ext_Next = 0;
 
 
 /***********************************************************************
@@ -172,12 +172,70 @@ x*/	void RXI_To_Block(RXIFRM *frm, REBVAL *out) {
 	blk = Make_Block(len = RXA_COUNT(frm));
 	for (n = 1; n <= len; n++) {
 		val = Append_Value(blk);
-		RXI_To_Value(val, frm->args[n], RXA_TYPE(frm, n));
+		RXI_To_Value(val, frm->args[n], len > 7 ? RXA_XTYPE(frm, n) : RXA_TYPE(frm, n));
 	}
 	Set_Block(out, blk);
 }
 
 
+/***********************************************************************
+**
+*/	static void Set_Command_Arg(RXIFRM *frm, REBCNT n, REBVAL *val)
+/*
+**		Store an arg in a command frame. RXA_COUNT must be set.
+**
+***********************************************************************/
+{
+	REBYTE type = Reb_To_RXT[VAL_TYPE(val)];
+
+	if (n < 8) RXA_TYPE(frm, n) = type;
+	RXA_XTYPE(frm, n) = type;
+	frm->args[n] = Value_To_RXI(val);
+}
+
+
+/***********************************************************************
+**
+*/	static void Command_Result(REBINT result, RXIFRM *frm, REBVAL *out)
+/*
+**		Convert the result of a command call to a value.
+**
+***********************************************************************/
+{
+	switch (result) {
+	case RXR_VALUE:
+		RXI_To_Value(out, frm->args[1], RXA_TYPE(frm, 1));
+		break;
+	case RXR_BLOCK:
+		RXI_To_Block(frm, out);
+		break;
+	case RXR_UNSET:
+		SET_UNSET(out);
+		break;
+	case RXR_NONE:
+		SET_NONE(out);
+		break;
+	case RXR_TRUE:
+		SET_TRUE(out);
+		break;
+	case RXR_FALSE:
+		SET_FALSE(out);
+		break;
+	case RXR_BAD_ARGS:
+		Trap0(RE_BAD_CMD_ARGS);
+		break;
+	case RXR_NO_COMMAND:
+		Trap0(RE_NO_CMD);
+		break;
+	case RXR_ERROR:
+		Trap0(RE_COMMAND_FAIL);
+		break;
+	default:
+		SET_UNSET(out);
+	}
+}
+
+
 /***********************************************************************
 **
 x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
@@ -278,6 +336,95 @@ x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
 }
 
 
+/***********************************************************************
+**
+*/	static void Call_Command_Each(REBVAL *cmd, REBVAL *data, REBVAL *out)
+/*
+**		Call a command once for each group of arguments in a block
+**		or vector, straight from the data without evaluation. The
+**		command context index is the position of the group. The
+**		results are a block, or a 64 bit vector for a vector when
+**		they are all integers or all decimals. When all are unset,
+**		the result is the number of calls.
+**
+***********************************************************************/
+{
+	REBVAL *func = BLK_HEAD(VAL_FUNC_BODY(cmd));
+	REBSER *words = VAL_FUNC_WORDS(cmd);
+	REBCNT argc = SERIES_TAIL(words) - 1; // not self
+	REBCNT len = VAL_LEN(data);
+	REBCNT calls;
+	REBCNT unsets = 0;
+	REBCNT n, i;
+	REBINT dec = -1; // vector type of results
+	REBEXT *ext = &Ext_List[VAL_I32(VAL_OBJ_VALUE(func, 1))];
+	REBINT code = (REBINT)VAL_INT64(func + 1);
+	REBSER *res;
+	REBVAL *val;
+	REBVAL arg;
+	REBCEC ctx;
+	RXIARG args[RXI_FRAME_ARGS(RXI_MAX_ARGS)];
+	RXIFRM *frm = (RXIFRM *)args;
+
+	if (argc == 0 || argc > RXI_MAX_ARGS || len % argc) Trap_Arg(data);
+	calls = len / argc;
+
+	res = Make_Block(calls);
+	Set_Block(out, res);
+
+	ctx.envr = 0;
+	ctx.block = IS_BLOCK(data) ? VAL_SERIES(data) : 0;
+
+	for (n = 0; n < calls; n++) {
+		RXA_COUNT(frm) = argc;
+		for (i = 1; i <= argc; i++) {
+			if (IS_VECTOR(data)) {
+				Set_Vector_Value(&arg, VAL_SERIES(data), VAL_INDEX(data) + n * argc + i - 1);
+				val = &arg;
+			}
+			else val = VAL_BLK_SKIP(data, n * argc + i - 1);
+			if (!TYPE_CHECK(BLK_SKIP(words, i), VAL_TYPE(val))) Trap_Arg(val);
+			Set_Command_Arg(frm, i, val);
+		}
+
+		ctx.index = VAL_INDEX(data) + n * argc;
+		val = Append_Value(res);
+		SET_NONE(val); // in case of error
+		Command_Result(ext->call(code, frm, &ctx), frm, val);
+
+		if (IS_UNSET(val)) unsets++;
+		if (n == 0) dec = IS_DECIMAL(val) ? 1 : IS_INTEGER(val) ? 0 : -1;
+		else if (dec != (IS_DECIMAL(val) ? 1 : IS_INTEGER(val) ? 0 : -1)) dec = -1;
+	}
+
+	if (unsets == calls) {
+		SET_INTEGER(out, calls);
+	}
+	else if (IS_VECTOR(data) && dec >= 0) {
+		REBSER *vect = Make_Vector(dec, 0, 0, 64, calls);
+		for (n = 0, val = BLK_HEAD(res); n < calls; n++, val++) {
+			if (dec) ((REBDEC*)vect->data)[n] = VAL_DECIMAL(val);
+			else ((REBI64*)vect->data)[n] = VAL_INT64(val);
+		}
+		Set_Series(REB_VECTOR, out, vect);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(call_each)
+/*
+**		routine args
+**
+***********************************************************************/
+{
+	if (IS_COMMAND(D_ARG(1))) Call_Command_Each(D_ARG(1), D_ARG(2), D_RET);
+	else Call_Routine_Each(D_ARG(1), D_ARG(2), D_RET);
+	return R_RET;
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(load_extension)
@@ -436,7 +583,8 @@ x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
 	REBCNT cmd;
 	REBCNT argc;
 	REBCNT n;
-	RXIFRM frm;	// args stored here
+	RXIARG args[RXI_FRAME_ARGS(RXI_MAX_ARGS)];
+	RXIFRM *frm = (RXIFRM *)args; // args stored here
 
 	// All of these were checked above on definition:
 	val = BLK_HEAD(VAL_FUNC_BODY(value));
@@ -444,48 +592,14 @@ x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
 	ext = &Ext_List[VAL_I32(VAL_OBJ_VALUE(val, 1))]; // Handler
 
 	// Copy args to command frame (array of args):
-	RXA_COUNT(&frm) = argc = SERIES_TAIL(VAL_FUNC_ARGS(value))-1; // not self
-	if (argc > 7) Trap0(RE_BAD_COMMAND);
+	argc = SERIES_TAIL(VAL_FUNC_ARGS(value))-1; // not self
+	if (argc > RXI_MAX_ARGS) Trap0(RE_BAD_COMMAND);
+	RXA_COUNT(frm) = argc;
 	val = DS_ARG(1);
-	for (n = 1; n <= argc; n++, val++) {
-		RXA_TYPE(&frm, n) = Reb_To_RXT[VAL_TYPE(val)];
-		frm.args[n] = Value_To_RXI(val);
-	}
+	for (n = 1; n <= argc; n++, val++) Set_Command_Arg(frm, n, val);
 
 	// Call the command:
-	n = ext->call(cmd, &frm, 0);
-	val = DS_RETURN;
-	switch (n) {
-	case RXR_VALUE:
-		RXI_To_Value(val, frm.args[1], RXA_TYPE(&frm, 1));
-		break;
-	case RXR_BLOCK:
-		RXI_To_Block(&frm, val);
-		break;
-	case RXR_UNSET:
-		SET_UNSET(val);
-		break;
-	case RXR_NONE:
-		SET_NONE(val);
-		break;
-	case RXR_TRUE:
-		SET_TRUE(val);
-		break;
-	case RXR_FALSE:
-		SET_FALSE(val);
-		break;
-	case RXR_BAD_ARGS:
-		Trap0(RE_BAD_CMD_ARGS);
-		break;
-	case RXR_NO_COMMAND:
-		Trap0(RE_NO_CMD);
-		break;
-	case RXR_ERROR:
-		Trap0(RE_COMMAND_FAIL);
-		break;
-	default:
-		SET_UNSET(val);
-	}
+	Command_Result(ext->call(cmd, frm, 0), frm, DS_RETURN);
 }
 
 
@@ -509,7 +623,8 @@ x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
 	REBVAL *args;
 	REBVAL *val;
 	REBVAL *func;
-	RXIFRM frm;	// args stored here
+	RXIARG frame[RXI_FRAME_ARGS(RXI_MAX_ARGS)];
+	RXIFRM *frm = (RXIFRM *)frame; // args stored here
 	REBCNT n;
 	REBEXT *ext;
 	REBCEC *ctx;
@@ -542,7 +657,9 @@ x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
 
 		// get command arguments and body
 		words = VAL_FUNC_WORDS(func);
-		RXA_COUNT(&frm) = SERIES_TAIL(VAL_FUNC_ARGS(func))-1; // not self
+		n = SERIES_TAIL(VAL_FUNC_ARGS(func))-1; // not self
+		if (n > RXI_MAX_ARGS) Trap0(RE_BAD_COMMAND);
+		RXA_COUNT(frm) = n;
 
 		// collect each argument (arg list already validated on MAKE)
 		n = 0;
@@ -573,42 +690,15 @@ x*/	int Do_Callback(REBSER *obj, u32 name, RXIARG *args, RXIARG *result)
 				Trap3(RE_EXPECT_ARG, cmd_word, args, Of_Type(val));
 
 			// put arg into command frame
-			n++;
-			RXA_TYPE(&frm, n) = Reb_To_RXT[VAL_TYPE(val)];
-			frm.args[n] = Value_To_RXI(val);
+			Set_Command_Arg(frm, ++n, val);
 		}
 
 		// Call the command (also supports different extension modules):
 		func  = BLK_HEAD(VAL_FUNC_BODY(func));
 		n = (REBCNT)VAL_INT64(func + 1);
 		ext = &Ext_List[VAL_I32(VAL_OBJ_VALUE(func, 1))]; // Handler
-		n = ext->call(n, &frm, context);
 		val = DS_RETURN;
-		switch (n) {
-		case RXR_VALUE:
-			RXI_To_Value(val, frm.args[1], RXA_TYPE(&frm, 1));
-			break;
-		case RXR_BLOCK:
-			RXI_To_Block(&frm, val);
-			break;
-		case RXR_UNSET:
-			SET_UNSET(val);
-			break;
-		case RXR_NONE:
-			SET_NONE(val);
-			break;
-		case RXR_TRUE:
-			SET_TRUE(val);
-			break;
-		case RXR_FALSE:
-			SET_FALSE(val);
-			break;
-		case RXR_ERROR:
-			Trap0(RE_COMMAND_FAIL);
-			break;
-		default:
-			SET_UNSET(val);
-		}
+		Command_Result(ext->call(n, frm, context), frm, val);
 
 		if (set_word) {
 			Set_Var(set_word, val);
@@ -250,14 +250,22 @@
 
 REBINT Emit_Decimal(REBYTE *cp, REBDEC d, REBFLG trim, REBYTE point, REBINT decimal_digits) {
 	REBYTE *start = cp, *sig, *rve;
+	REBYTE fast[20];
 	int e, sgn;
 	REBINT digits_obtained;
+	REBCNT len;
 
 	/* sanity checks */
 	if (decimal_digits < MIN_DIGITS) decimal_digits = MIN_DIGITS;
 	else if (decimal_digits > MAX_DIGITS) decimal_digits = MAX_DIGITS;
 
-	sig = (REBYTE *) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
+	// Shortest digits via Grisu3, dtoa only for what it cannot decide:
+	if (d != 0.0 && (len = Fast_Dtoa(d, fast, &e))) {
+		sig = fast;
+		rve = fast + len;
+		sgn = d < 0.0;
+	}
+	else sig = (REBYTE *) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
 
 	digits_obtained = rve - sig;
 
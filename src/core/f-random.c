@@ -54,7 +54,7 @@
 #define MM ((REBI64)1<<62)					/* the modulus, 2^62 */
 #define mod_diff(x,y) (((x)-(y))&(MM-1))	/* subtraction mod MM */
 
-static REBI64 ran_x[KK];					/* the generator state */
+static INSTANCE REBI64 ran_x[KK];					/* the generator state */
 
 #ifdef __STDC__
 void ran_array(REBI64 aa[], int n)
@@ -75,9 +75,9 @@ void ran_array(aa,n)	/* put n new random numbers in aa */
 /* after calling Set_Random, get new randoms by, e.g., "x=ran_arr_next()" */
 
 #define QUALITY 1009 /* recommended quality level for high-res use */
-static REBI64 ran_arr_buf[QUALITY];
+static INSTANCE REBI64 ran_arr_buf[QUALITY];
 static REBI64 ran_arr_dummy=-1, ran_arr_started=-1;
-static REBI64 *ran_arr_ptr=&ran_arr_dummy;	/* the next random number, or -1 */
+static INSTANCE REBI64 *ran_arr_ptr;	/* the next random number, or -1 (set at boot) */
 
 #define TT	70		/* guaranteed separation between streams */
 #define is_odd(x)	((x)&1)			/* units bit of x */
@@ -1621,6 +1621,7 @@ exit_block:
 	REBSER *blk;
     SCAN_STATE scan_state;
 
+	Unview_Binary(D_ARG(1));
     Init_Scan_State(&scan_state, VAL_BIN_DATA(D_ARG(1)), VAL_LEN(D_ARG(1)));
 
 	if (D_REF(2)) SET_FLAG(scan_state.opts, SCAN_NEXT);
@@ -1638,6 +1639,317 @@ exit_block:
 }
 
 
+/***********************************************************************
+**
+**	Block Images
+**
+**		A block image is the scanned form of a block, so it can be
+**		loaded again without the scan. It is the "RBI1" signature, the
+**		number of word spellings, the spellings (each a length and
+**		UTF-8 bytes), then the block. Numbers are 7 bits per byte, low
+**		bits first, with the high bit set when more bytes follow.
+**
+**		A block is its length then its values. Each value starts with
+**		its datatype byte, plus 128 if a new line is marked before it.
+**		Words are followed by their spelling index, blocks by their
+**		values, strings by their UTF-8 length and bytes, and integers
+**		by 8 bytes low byte first. Other values have a datatype byte of
+**		zero and are kept as zero terminated text for the scanner.
+**
+**		The boot image is made by make-boot.r in this same form.
+**
+***********************************************************************/
+
+typedef struct Reb_Image_State {
+	REBYTE *cp;
+	REBYTE *end;
+	REBCNT *syms;		// symbols of the spellings
+	REBCNT num_syms;
+	REBSER *out;		// values when saving
+	REBSER *words;		// spellings when saving
+} IMAGE_STATE;
+
+
+/***********************************************************************
+**
+*/	static REBFLG Image_Num(IMAGE_STATE *is, REBCNT *num)
+/*
+**		Read a number of the image. Returns FALSE at the end.
+**
+***********************************************************************/
+{
+	REBCNT n = 0;
+	REBCNT shift;
+
+	for (shift = 0; is->cp < is->end && shift < 32; shift += 7) {
+		n |= (REBCNT)(*is->cp & 0x7f) << shift;
+		if (!(*is->cp++ & 0x80)) {
+			*num = n;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Image_Block(IMAGE_STATE *is)
+/*
+**		Make a block of the image. The values are the same as
+**		scanning their text would give. Returns zero if not valid.
+**
+***********************************************************************/
+{
+	REBSER *block;
+	REBSER *ser;
+	REBVAL *value;
+	REBYTE type;
+	REBU64 i;
+	REBCNT len;
+	REBCNT n;
+	REBCNT k;
+
+	// Each value takes a byte at least:
+	if (!Image_Num(is, &len) || len > (REBCNT)(is->end - is->cp)) return 0;
+
+	block = Make_Block(len);
+	value = BLK_HEAD(block);
+
+	for (n = 0; n < len; n++, value++) {
+		if (is->cp >= is->end) return 0;
+		type = *is->cp++;
+		if ((type & 0x7f) >= REB_MAX) return 0;
+		VAL_SET(value, type & 0x7f);
+
+		if (IS_END(value)) {
+			for (k = 0; is->cp + k < is->end && is->cp[k]; k++);
+			if (k == 0 || is->cp + k >= is->end) return 0;
+			ser = Scan_Source(is->cp, k);
+			if (SERIES_TAIL(ser) != 1) return 0;
+			*value = *BLK_HEAD(ser);
+			Free_Series(ser);
+			is->cp += k + 1;
+		}
+		else if (ANY_WORD(value)) {
+			if (!Image_Num(is, &k) || k >= is->num_syms) return 0;
+			VAL_WORD_SYM(value) = is->syms[k];
+			VAL_WORD_FRAME(value) = 0;
+		}
+		else if (ANY_BLOCK(value)) {
+			Check_Stack();
+			if (!(VAL_SERIES(value) = Image_Block(is))) return 0;
+			VAL_INDEX(value) = 0;
+		}
+		else if (IS_STRING(value)) {
+			if (!Image_Num(is, &k) || k > (REBCNT)(is->end - is->cp)) return 0;
+			VAL_SERIES(value) = Append_UTF8(0, is->cp, k);
+			VAL_INDEX(value) = 0;
+			is->cp += k;
+		}
+		else if (IS_INTEGER(value)) {
+			if (is->end - is->cp < 8) return 0;
+			for (i = 0, k = 8; k > 0; k--) i = (i << 8) | is->cp[k - 1];
+			VAL_INT64(value) = (REBI64)i;
+			is->cp += 8;
+		}
+		else return 0;
+
+		if (type & 0x80) VAL_SET_LINE(value);
+	}
+
+	SERIES_TAIL(block) = len;
+	BLK_TERM(block);
+
+	return block;
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Load_Block_Image(REBYTE *data, REBCNT len)
+/*
+**		Make the block of a block image. Symbols are made in the
+**		order of the spellings. Returns zero if the image is not
+**		valid.
+**
+***********************************************************************/
+{
+	IMAGE_STATE is;
+	REBSER *block = 0;
+	REBCNT size;
+	REBCNT k;
+	REBCNT n;
+
+	if (len < 4 || data[0] != 'R' || data[1] != 'B' || data[2] != 'I' || data[3] != '1') return 0;
+
+	is.cp = data + 4;
+	is.end = data + len;
+	if (!Image_Num(&is, &is.num_syms) || is.num_syms > len) return 0;
+
+	size = (is.num_syms + 1) * sizeof(REBCNT);
+	is.syms = Make_Mem(size);
+
+	for (n = 0; n < is.num_syms; n++) {
+		if (!Image_Num(&is, &k) || k == 0 || k > (REBCNT)(is.end - is.cp)) break;
+		if (!(is.syms[n] = Make_Word(is.cp, k))) break;
+		is.cp += k;
+	}
+
+	if (n == is.num_syms) {
+		block = Image_Block(&is);
+		if (is.cp != is.end) block = 0;
+	}
+
+	Free_Mem(is.syms, size);
+
+	return block;
+}
+
+
+/***********************************************************************
+**
+*/	static void Emit_Image_Num(REBSER *out, REBCNT n)
+/*
+***********************************************************************/
+{
+	for (; n >= 0x80; n >>= 7) Append_Byte(out, (n & 0x7f) | 0x80);
+	Append_Byte(out, n);
+}
+
+
+/***********************************************************************
+**
+*/	static void Emit_Image_Block(IMAGE_STATE *is, REBVAL *value)
+/*
+**		Emit the values of a block, from its index.
+**
+***********************************************************************/
+{
+	REBSER *ser;
+	REBSER *scan;
+	REBVAL str;
+	REBYTE *name;
+	REBU64 i;
+	REBCNT sym;
+	REBCNT n;
+
+	Check_Stack();
+	Emit_Image_Num(is->out, VAL_LEN(value));
+
+	for (value = VAL_BLK_DATA(value); NOT_END(value); value++) {
+		if (VAL_TYPE(value) >= REB_NATIVE) Trap_Arg(value);
+		n = VAL_TYPE(value) | (VAL_GET_LINE(value) ? 0x80 : 0);
+
+		if (ANY_WORD(value)) {
+			sym = VAL_WORD_SYM(value);
+			if (!is->syms[sym]) {
+				is->syms[sym] = ++is->num_syms;
+				name = Get_Sym_Name(sym);
+				Emit_Image_Num(is->words, LEN_BYTES(name));
+				Append_Bytes(is->words, name);
+			}
+			Append_Byte(is->out, n);
+			Emit_Image_Num(is->out, is->syms[sym] - 1);
+		}
+		else if (ANY_BLOCK(value) && VAL_INDEX(value) == 0) {
+			Append_Byte(is->out, n);
+			Emit_Image_Block(is, value);
+		}
+		else if (IS_STRING(value) && VAL_INDEX(value) == 0) {
+			Append_Byte(is->out, n);
+			ser = Encode_UTF8_Value(value, VAL_LEN(value), 0);
+			Emit_Image_Num(is->out, SERIES_TAIL(ser));
+			Append_Bytes_Len(is->out, BIN_HEAD(ser), SERIES_TAIL(ser));
+			Free_Series(ser);
+		}
+		else if (IS_INTEGER(value)) {
+			Append_Byte(is->out, n);
+			for (i = (REBU64)VAL_INT64(value), n = 0; n < 8; n++, i >>= 8)
+				Append_Byte(is->out, (REBYTE)i);
+		}
+		else {
+			// Kept as text, which must scan back as the same one value,
+			// or the whole image could not be loaded (e.g. <a>b>):
+			Append_Byte(is->out, n & 0x80);
+			Set_String(&str, Copy_Mold_Value(value, 1 << MOPT_MOLD_ALL));
+			ser = Encode_UTF8_Value(&str, VAL_LEN(&str), 0);
+			scan = Scan_Source(BIN_HEAD(ser), SERIES_TAIL(ser));
+			if (SERIES_TAIL(scan) != 1 || VAL_TYPE(BLK_HEAD(scan)) != VAL_TYPE(value)) Trap_Arg(value);
+			Free_Series(scan);
+			Append_Bytes_Len(is->out, BIN_HEAD(ser), SERIES_TAIL(ser));
+			Append_Byte(is->out, 0);
+			Free_Series(ser);
+			Free_Series(VAL_SERIES(&str));
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Save_Block_Image(REBVAL *block)
+/*
+**		Make the block image of a block, from its index. Word
+**		bindings are not kept. Functions, objects, ports and
+**		other values that cannot be scanned back are an error.
+**
+***********************************************************************/
+{
+	IMAGE_STATE is;
+	REBSER *syms;
+	REBSER *ser;
+
+	// Spelling index + 1 of each symbol:
+	syms = Make_Series(SERIES_TAIL(PG_Word_Table.series) + 1, sizeof(REBCNT), FALSE);
+	CLEAR(syms->data, SERIES_REST(syms) * sizeof(REBCNT));
+	is.syms = (REBCNT *)syms->data;
+	is.num_syms = 0;
+	is.out = Make_Binary(VAL_LEN(block) * 4);
+	is.words = Make_Binary(VAL_LEN(block) * 4);
+
+	Emit_Image_Block(&is, block);
+
+	ser = Make_Binary(4 + 5 + SERIES_TAIL(is.words) + SERIES_TAIL(is.out));
+	Append_Bytes(ser, "RBI1");
+	Emit_Image_Num(ser, is.num_syms);
+	Append_Bytes_Len(ser, BIN_HEAD(is.words), SERIES_TAIL(is.words));
+	Append_Bytes_Len(ser, BIN_HEAD(is.out), SERIES_TAIL(is.out));
+
+	Free_Series(is.out);
+	Free_Series(is.words);
+	Free_Series(syms);
+
+	return ser;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(encode_block)
+/*
+***********************************************************************/
+{
+	Set_Binary(D_RET, Save_Block_Image(D_ARG(1)));
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(decode_block)
+/*
+***********************************************************************/
+{
+	REBSER *block = Load_Block_Image(VAL_BIN_DATA(D_ARG(1)), VAL_LEN(D_ARG(1)));
+
+	if (!block) return R_NONE;
+	DS_RELOAD(ds); // in case stack moved
+	Set_Block(D_RET, block);
+	return R_RET;
+}
+
+
 /***********************************************************************
 **
 */  REBCNT Scan_Word(REBYTE *cp, REBCNT len)
@@ -280,7 +280,8 @@ bad_hex:	Trap0(RE_INVALID_CHARS);
 	if ((REBCNT)(cp-bp) != len) return 0;
 
 	VAL_SET(value, REB_DECIMAL);
-	VAL_DECIMAL(value) = STRTOD((char *)buf, &se); // need check for NaN, and INF !!!
+	if (!Fast_Strtod(buf, &VAL_DECIMAL(value)))
+		VAL_DECIMAL(value) = STRTOD((char *)buf, &se); // need check for NaN, and INF !!!
 	if (fabs(VAL_DECIMAL(value)) == HUGE_VAL) Trap0(RE_OVERFLOW);
 	return cp;
 }
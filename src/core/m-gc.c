@@ -87,8 +87,8 @@ extern REBOL_HOST_LIB *Host_Lib;
 
 //-- For Serious Debugging:
 #ifdef WATCH_GC_VALUE
-REBSER *Watcher = 0;
-REBVAL *WatchVar = 0;
+INSTANCE REBSER *Watcher = 0;
+INSTANCE REBVAL *WatchVar = 0;
 REBVAL *GC_Break_Point(REBVAL *val) {return val;}
 REBVAL *N_watch(REBFRM *frame, REBVAL **inter_block)
 {
@@ -189,16 +189,18 @@ static void Mark_Value(REBVAL *val, REBCNT depth);
 {
 	int len = 0;
 	REBSER *series = NULL;
-	if (IS_MARK_SERIES(STRUCT_DATA_BIN(stu))) return;
-
-	CHECK_MARK(stu->spec, depth);
-	CHECK_MARK(stu->fields, depth);
-	CHECK_MARK(STRUCT_DATA_BIN(stu), depth);
 
 	ASSERT2(IS_BARE_SERIES(stu->data), RP_BAD_SERIES);
 	ASSERT2(!IS_EXT_SERIES(stu->data), RP_BAD_SERIES);
 	ASSERT2(SERIES_TAIL(stu->data) == 1, RP_BAD_SERIES);
+
+	// The data binary may already carry a mark when it is one of the
+	// GC_Infants, so the series of this value are marked before the check.
+	CHECK_MARK(stu->spec, depth);
+	CHECK_MARK(stu->fields, depth);
 	CHECK_MARK(stu->data, depth);
+	if (IS_MARK_SERIES(STRUCT_DATA_BIN(stu))) return;
+	CHECK_MARK(STRUCT_DATA_BIN(stu), depth);
 
 	series = stu->fields;
 	for (len = 0; len < series->tail; len++) {
@@ -291,7 +293,7 @@ static void Mark_Value(REBVAL *val, REBCNT depth);
 	int d;
 	REBDEV *dev;
 	REBREQ *req;
-	REBDEV **devices = Host_Lib->devices;
+	REBDEV **devices = OS_DEVICES(); // pending lists of this thread
 	
 	for (d = 0; d < RDI_MAX; d++) {
 		dev = devices[d];
@@ -301,6 +303,20 @@ static void Mark_Value(REBVAL *val, REBCNT depth);
 	}
 }
 
+/***********************************************************************
+**
+*/ static void Mark_Timers(REBCNT depth)
+/*
+**  Mark the ports of requests with armed timers.
+**
+***********************************************************************/
+{
+	REBREQ *req = 0;
+
+	while ((req = Next_Timed_Request(req)))
+		if (req->port) CHECK_MARK((REBSER*)req->port, depth);
+}
+
 /***********************************************************************
 **
 */ static void Mark_Auxiliary(REBCNT depth)
@@ -355,6 +371,7 @@ static void Mark_Value(REBVAL *val, REBCNT depth);
 			// these are special word bindings (to typesets if used).
 			if (VAL_FRM_WORDS(val)) MARK_SERIES(VAL_FRM_WORDS(val));
 			if (VAL_FRM_SPEC(val)) {CHECK_MARK(VAL_FRM_SPEC(val), depth);}
+			if (VAL_FRM_PARENT(val)) {CHECK_MARK(VAL_FRM_PARENT(val), depth);}
 			break;
 
 		case REB_PORT:
@@ -444,6 +461,10 @@ mark_obj:
 			MARK_SERIES(VAL_SERIES(val));
 			break;
 
+		case REB_TABLE:
+			CHECK_MARK(VAL_SERIES(val), depth);
+			break;
+
 		case REB_BLOCK:
 		case REB_PAREN:
 		case REB_PATH:
@@ -736,6 +757,32 @@ mark_obj:
 	return count;
 }
 
+/***********************************************************************
+**
+*/	static void Mark_Views(void)
+/*
+**		Mark the series that own the data of marked views. Views
+**		that were not marked are about to be swept, so forget them.
+**
+***********************************************************************/
+{
+	REBSER **sp = (REBSER **)GC_Views->data;
+	REBCNT n;
+
+	for (n = 0; n < SERIES_TAIL(GC_Views);) {
+		if (IS_MARK_SERIES(sp[n])) {
+			CHECK_MARK(sp[n+1], 0);
+			n += 2;
+		}
+		else {
+			GC_Views->tail -= 2;
+			sp[n] = sp[GC_Views->tail];
+			sp[n+1] = sp[GC_Views->tail + 1];
+		}
+	}
+}
+
+
 /***********************************************************************
 **
 */	REBCNT Recycle(void)
@@ -781,6 +828,13 @@ mark_obj:
 		Mark_Series(*sp++, 0);
 	}
 
+	// Mark the frames and copies of closure literals:
+	sp = (REBSER **)GC_Unshared->data;
+	for (n = SERIES_TAIL(GC_Unshared); n > 0; n -= 4, sp += 4) {
+		Mark_Series(sp[1], 0);
+		Mark_Series(sp[3], 0);
+	}
+
 	// Mark all special series:
 	sp = (REBSER **)GC_Series->data;
 	for (n = SERIES_TAIL(GC_Series); n > 0; n--) {
@@ -804,7 +858,11 @@ mark_obj:
 
 	// Mark all devices:
 	Mark_Devices(0);
+	Mark_Timers(0);
 	Mark_Auxiliary(0);
+
+	// Must follow all other marking:
+	Mark_Views();
 	
 	count = Sweep_Routines(); // this needs to run before Sweep_Series(), because Routine has series with pointers, which can't be simply discarded by Sweep_Series
 
@@ -904,4 +962,33 @@ mark_obj:
 
 	GC_Series = Make_Series(60, sizeof(REBSER *), FALSE);
 	KEEP_SERIES(GC_Series, "gc guarded");
+
+	// Pairs of view series and the series owning their data:
+	GC_Views = Make_Series(16, sizeof(REBSER *), FALSE);
+	KEEP_SERIES(GC_Views, "gc views");
+
+	// Closure literal copies, four entries each (see Unshare_Value):
+	GC_Unshared = Make_Series(16, sizeof(REBSER *), FALSE);
+	KEEP_SERIES(GC_Unshared, "gc unshared");
+}
+
+
+/***********************************************************************
+**
+*/	void Dispose_Memory(void)
+/*
+**		Free the memory system. The reverse of Init_Memory.
+**
+***********************************************************************/
+{
+	GC_Active = 0;
+	GC_Disabled = 1;
+
+	Free_Pools();
+
+	Free_Mem(GC_Infants, (MAX_SAFE_SERIES + 2) * sizeof(REBSER*));
+	Free_Mem(Prior_Expand, MAX_EXPAND_LIST * sizeof(REBSER*));
+	GC_Infants = 0;
+	Prior_Expand = 0;
+	GC_Protect = GC_Series = GC_Views = GC_Unshared = 0;
 }
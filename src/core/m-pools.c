@@ -183,6 +183,50 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 }
 
 
+/***********************************************************************
+**
+*/	void Free_Pools(void)
+/*
+**		Release all pool segments, and the series data allocated
+**		outside the pools, back to the system. After this call no
+**		series may be used (see Dispose_Core).
+**
+***********************************************************************/
+{
+	REBSEG	*seg;
+	REBSEG	*next;
+	REBSER	*series;
+	REBCNT	n;
+
+	GC_Stay_Dirty = FALSE;
+
+	// Large series data is not in a segment, so free it first:
+	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
+		series = (REBSER *) (seg + 1);
+		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--) {
+			SKIP_WALL(series);
+			if (!SERIES_FREED(series)) Free_Series_Data(series, FALSE);
+			series++;
+			SKIP_WALL(series);
+		}
+	}
+
+	for (n = 0; n < MAX_POOLS; n++) {
+		for (seg = Mem_Pools[n].segs; seg; seg = next) {
+			ASAN_UNPOISON_MEMORY_REGION(seg, sizeof(REBSEG));
+			next = seg->next;
+			ASAN_UNPOISON_MEMORY_REGION(seg, seg->size);
+			Free_Mem(seg, seg->size);
+		}
+	}
+
+	Free_Mem(Mem_Pools, sizeof(REBPOL) * MAX_POOLS);
+	Free_Mem(PG_Pool_Map, (4 * MEM_BIG_SIZE) + 4);
+	Mem_Pools = 0;
+	PG_Pool_Map = 0;
+}
+
+
 #ifndef POOL_MAP
 /***********************************************************************
 **
@@ -58,6 +58,13 @@
 **		WARNING: never use direct pointers into the series data, as the
 **		series data can be relocated in memory.
 **
+**		Views (see Make_View_Series) are the exception: when the data
+**		is reallocated or the head moves, Move_Views updates them.
+**		That scans GC_Views, which holds only views still alive (the
+**		GC drops the others), so it costs nothing when no SLICE is in
+**		use. Any code that moves the data or the head of a series
+**		must call Move_Views the same way.
+**
 ***********************************************************************/
 {
 	REBCNT start;
@@ -76,6 +83,7 @@
 		SERIES_TAIL(series) += delta;
 		SERIES_REST(series) += delta;
 		SERIES_SUB_BIAS(series, delta);
+		if (SERIES_TAIL(GC_Views)) Move_Views(series, series->data + SERIES_WIDE(series) * delta);
 		return;
 	}
 
@@ -145,6 +153,8 @@
 		swap = *series;
 		*series = *newser;
 		*newser = swap;
+		SERIES_CLR_FLAG(series, SER_EXT); // the new data is our own
+		if (SERIES_TAIL(GC_Views)) Move_Views(series, newser->data);
 		Free_Series(newser);
 		SERIES_SET_BIAS(series, 0); // be sure it is reset
 
@@ -182,6 +192,123 @@
 }
 
 
+/***********************************************************************
+**
+*/	REBSER *Make_View_Series(REBSER *series, REBCNT index, REBCNT len)
+/*
+**		Make a series that is a view of part of another series: its
+**		header points into the data of that series, so no data is
+**		copied. The view is protected from modification, and
+**		UNPROTECT leaves it so (see Protect_Series).
+**
+**		GC_Views pairs each view with the series that owns its data.
+**		The GC keeps that series alive for as long as the view is,
+**		and Expand_Series moves views along when it reallocates.
+**
+***********************************************************************/
+{
+	REBSER *view;
+	REBSER **sp = (REBSER **)GC_Views->data;
+	REBCNT n;
+
+	if (index > series->tail) index = series->tail;
+	if (len > series->tail - index) len = series->tail - index;
+
+	view = (REBSER *)Make_Node(SERIES_POOL);
+	view->data = series->data + index * SERIES_WIDE(series);
+	view->tail = len;
+	SERIES_REST(view) = len;
+	view->info = SERIES_WIDE(series); // clears flags
+	view->all = series->all;
+	LABEL_SERIES(view, "view");
+	EXT_SERIES(view);
+	PROTECT_SERIES(view);
+
+	PG_Reb_Stats->Series_Made++;
+	PG_Reb_Stats->Series_Memory += SERIES_TOTAL(view);
+
+	// A view of a view shares the data of the original series:
+	if (IS_EXT_SERIES(series)) {
+		for (n = 0; n < SERIES_TAIL(GC_Views); n += 2) {
+			if (sp[n] == series) {
+				series = sp[n+1];
+				break;
+			}
+		}
+	}
+
+	if (SERIES_REST(GC_Views) < SERIES_TAIL(GC_Views) + 3) Extend_Series(GC_Views, 8);
+	sp = (REBSER **)GC_Views->data;
+	sp[GC_Views->tail++] = view;
+	sp[GC_Views->tail++] = series;
+
+	return view;
+}
+
+
+/***********************************************************************
+**
+*/	void Unview_Binary(REBVAL *val)
+/*
+**		The scanner stops at the terminator, which a view does not
+**		have at its tail, so replace a view with a copy to scan it.
+**
+***********************************************************************/
+{
+	if (IS_EXT_SERIES(VAL_SERIES(val))) {
+		VAL_SERIES(val) = Copy_Bytes(VAL_BIN_DATA(val), VAL_LEN(val));
+		VAL_INDEX(val) = 0;
+	}
+}
+
+
+/***********************************************************************
+**
+*/	void Trim_Views(REBSER *series)
+/*
+**		The tail of a series has moved down. Views of it keep to
+**		its data up to the new tail; a view past it is left empty
+**		at the tail.
+**
+***********************************************************************/
+{
+	REBSER **sp = (REBSER **)GC_Views->data;
+	REBYTE *tail = series->data + series->tail * SERIES_WIDE(series);
+	REBSER *view;
+	REBCNT n;
+
+	for (n = 0; n < SERIES_TAIL(GC_Views); n += 2) {
+		view = sp[n];
+		if (sp[n+1] != series || !IS_EXT_SERIES(view) || view->data < series->data) continue;
+		if (view->data >= tail) {
+			view->data = tail;
+			view->tail = 0;
+		}
+		else if (view->data + view->tail * SERIES_WIDE(view) > tail)
+			view->tail = (tail - view->data) / SERIES_WIDE(view);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	void Move_Views(REBSER *series, REBYTE *old_data)
+/*
+**		The data of a series has been reallocated, or its head has
+**		moved. Views of it keep their position from the head.
+**
+***********************************************************************/
+{
+	REBSER **sp = (REBSER **)GC_Views->data;
+	REBCNT n;
+
+	for (n = 0; n < SERIES_TAIL(GC_Views); n += 2) {
+		if (sp[n+1] == series && IS_EXT_SERIES(sp[n]))
+			sp[n]->data = series->data + (sp[n]->data - old_data);
+	}
+}
+
+
 /***********************************************************************
 **
 */	REBCNT Insert_Series(REBSER *series, REBCNT index, REBYTE *data, REBCNT len)
@@ -330,6 +457,11 @@
 **		Remove a series of values (bytes, longs, reb-vals) from the
 **		series at the given index.
 **
+**		Views of the series are kept in bounds: Move_Views when the
+**		head moves, then Trim_Views for the new tail. Any code that
+**		lowers the tail of a series must call Trim_Views too (as the
+**		clear and reset functions below do).
+**
 ***********************************************************************/
 {
 	REBCNT	start;
@@ -340,6 +472,8 @@
 
 	// Optimized case of head removal:
 	if (index == 0) {
+		REBYTE *head = series->data;
+
 		if ((REBCNT)len > series->tail) len = series->tail;
 		SERIES_TAIL(series) -= len;
 		if (SERIES_TAIL(series) == 0) {
@@ -349,6 +483,7 @@
 			SERIES_REST(series) += len;
 			series->data -= SERIES_WIDE(series) * len;
 			CLEAR(series->data, SERIES_WIDE(series)); // terminate
+			if (SERIES_TAIL(GC_Views)) Move_Views(series, head);
 		} else {
 			// Add bias to head:
 			REBCNT bias = SERIES_BIAS(series);
@@ -364,10 +499,12 @@
 				SERIES_SET_BIAS(series, 0);
 
 				memmove(series->data, data, SERIES_USED(series));
+				if (SERIES_TAIL(GC_Views)) Move_Views(series, head);
 			} else {
 				SERIES_SET_BIAS(series, bias);
 				SERIES_REST(series) -= len;
 				series->data += SERIES_WIDE(series) * len;
+				if (SERIES_TAIL(GC_Views)) Move_Views(series, head);
 				if (NZ(start = SERIES_BIAS(series))) {
 					// If more than half biased:
 					if (start >= MAX_SERIES_BIAS || start > SERIES_REST(series))
@@ -375,6 +512,7 @@
 				}
 			}
 		}
+		if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 		return;
 	}
 
@@ -386,6 +524,7 @@
 	if (len + index >= series->tail) {
 		series->tail = index;
 		CLEAR(series->data + start, SERIES_WIDE(series));
+		if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 		return;
 	}
 
@@ -394,6 +533,7 @@
 	len *= SERIES_WIDE(series);
 	data = series->data + start;
 	memmove(data, data + len, length - (start + len));
+	if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 
 	CHECK_MEMORY(5);
 }
@@ -410,6 +550,7 @@
 	if (series->tail == 0) return;
 	series->tail--;
 	CLEAR(series->data + SERIES_WIDE(series) * series->tail, SERIES_WIDE(series));
+	if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 }
 
 
@@ -430,6 +571,7 @@
 	series->data -= SERIES_WIDE(series) * len;
 
 	memmove(series->data, data, SERIES_USED(series));
+	if (SERIES_TAIL(GC_Views)) Move_Views(series, data);
 }
 
 
@@ -445,6 +587,7 @@
 	series->tail = 0;
 	if (SERIES_BIAS(series)) Reset_Bias(series);
 	CLEAR(series->data, SERIES_WIDE(series)); // re-terminate
+	if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 }
 
 
@@ -460,6 +603,7 @@
 	series->tail = 0;
 	if (SERIES_BIAS(series)) Reset_Bias(series);
 	CLEAR(series->data, SERIES_SPACE(series));
+	if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 }
 
 
@@ -477,6 +621,7 @@
 	EXPAND_SERIES_TAIL(series, size);
 	series->tail = 0;
 	CLEAR(series->data, SERIES_WIDE(series)); // re-terminate
+	if (SERIES_TAIL(GC_Views)) Trim_Views(series);
 }
 
 
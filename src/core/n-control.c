@@ -105,9 +105,11 @@ enum {
 
 	if (IS_MARK_SERIES(series)) return; // avoid loop
 
+	// A view (external data) stays protected, as it writes into
+	// the series it views (see Make_View_Series):
 	if (GET_FLAG(flags, PROT_SET))
 		PROTECT_SERIES(series);
-	else
+	else if (!IS_EXT_SERIES(series))
 		UNPROTECT_SERIES(series);
 
 	if (!ANY_BLOCK(val) || !GET_FLAG(flags, PROT_DEEP)) return;
@@ -142,6 +144,7 @@ enum {
 	if (!GET_FLAG(flags, PROT_DEEP)) return;
 
 	MARK_SERIES(series); // recursion protection
+	Unshare_Frame(series);
 
 	for (value = FRM_VALUES(series)+1; NOT_END(value); value++) {
 		Protect_Value(value, flags);
@@ -229,6 +232,10 @@ enum {
 	
 	if (GET_FLAG(flags, PROT_HIDE)) Trap0(RE_BAD_REFINES);
 
+	// A view cannot be unprotected:
+	if (!GET_FLAG(flags, PROT_SET) && ANY_SERIES(val) && IS_EXT_SERIES(VAL_SERIES(val)))
+		Trap0(RE_PROTECTED);
+
 	Protect_Value(val, flags);
 
 	if (GET_FLAG(flags, PROT_DEEP)) Unmark(val);
@@ -303,7 +310,7 @@ enum {
 /*
 ***********************************************************************/
 {
-	Try_Block(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)));
+	Try_Block(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)), TRUE);
 	if (IS_ERROR(DS_NEXT) && !IS_THROW(DS_NEXT)) return R_NONE;
 	return R_TOS1;
 }
@@ -740,7 +747,8 @@ got_err:
 	REBFLG except = D_REF(2);
 	REBVAL handler = *D_ARG(3); // TRY exception will trim the stack
 
-	if (Try_Block(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)))) {
+	// A block handler does not see the error, so it need not be made:
+	if (Try_Block(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)), except && IS_BLOCK(&handler))) {
 		if (except) {
 			if (IS_BLOCK(&handler)) {
 				DO_BLK(&handler);
@@ -404,6 +404,7 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 	}
 	else if (IS_OBJECT(word)) {
 		Assert_Public_Object(word);
+		Unshare_Frame(VAL_OBJ_FRAME(word));
 		Set_Block(D_RET, Copy_Block(VAL_OBJ_FRAME(word), 1));
 		return R_RET;
 	}
@@ -497,6 +498,29 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 }
 
 
+/***********************************************************************
+**
+*/	REBNATIVE(prototype)
+/*
+**		Objects made from a prototype reuse its word list and do
+**		not copy its blocks, strings and functions until they are
+**		used (see Make_Prototype).
+**
+***********************************************************************/
+{
+	REBSER *frame = VAL_OBJ_FRAME(D_ARG(1));
+
+	if (FRM_PARENT(frame) != frame) Unshare_Frame(frame);
+	if (D_REF(2)) {
+		Unshare_Frame(frame);
+		FRM_PARENT(frame) = 0;
+	}
+	else Make_Prototype(frame);
+
+	return R_ARG1;
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(set)
@@ -782,6 +806,25 @@ static int Do_Ordinal(REBVAL *ds, REBINT n)
 }
 
 
+/***********************************************************************
+**
+*/	REBNATIVE(slice)
+/*
+***********************************************************************/
+{
+	REBVAL *val = D_ARG(1);
+	REBCNT len = Int32s(D_ARG(2), 0);
+	REBSER *ser;
+
+	if (IS_VECTOR(val)) ser = Make_Vector_View(val, len);
+	else ser = Make_View_Series(VAL_SERIES(val), VAL_INDEX(val), len);
+
+	VAL_SERIES(val) = ser;
+	VAL_INDEX(val) = 0;
+	return R_ARG1;
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(first_add)
@@ -110,8 +110,18 @@ static REBSER *Read_All_File(char *fname)
 **
 ***********************************************************************/
 {
-	Set_String(D_RET, Copy_Form_Value(D_ARG(1), 0));
-	return R_RET;
+	REB_MOLD mo = {0};
+
+	if (!D_REF(2)) {
+		Set_String(D_RET, Copy_Form_Value(D_ARG(1), 0));
+		return R_RET;
+	}
+
+	Reset_Mold(&mo);
+	Mold_Value(&mo, D_ARG(1), 0);
+	Insert_Mold(&mo, D_ARG(3));
+
+	return R_ARG3;
 }
 
 
@@ -124,6 +134,7 @@ static REBSER *Read_All_File(char *fname)
 **		/only   "For a block value, give only contents, no outer [ ]"
 **		/all	"Mold in serialized format"
 **		/flat	"No line indentation"
+**		/into	"Insert the result into a string"
 **
 ***********************************************************************/
 {
@@ -139,6 +150,12 @@ static REBSER *Read_All_File(char *fname)
 
 	Mold_Value(&mo, val, TRUE);
 
+	if (D_REF(5)) {
+		Insert_Mold(&mo, D_ARG(6));
+		*D_RET = *D_ARG(6);
+		return R_RET;
+	}
+
 	Set_String(D_RET, Copy_String(mo.series, 0, -1));
 
 	return R_RET;
@@ -317,7 +334,7 @@ static REBSER *Read_All_File(char *fname)
 ***********************************************************************/
 {
 	REBVAL *val = D_ARG(1);
-	REBINT timeout = 0;	// in milliseconds
+	REBI64 timeout = 0;	// in microseconds
 	REBSER *ports = 0;
 	REBINT n = 0;
 
@@ -339,17 +356,9 @@ static REBSER *Read_All_File(char *fname)
 
 	switch (VAL_TYPE(val)) {
 	case REB_INTEGER:
-		timeout = 1000 * Int32(val);
-		goto chk_neg;
-
 	case REB_DECIMAL:
-		timeout = (REBINT)(1000 * VAL_DECIMAL(val));
-		goto chk_neg;
-
 	case REB_TIME:
-		timeout = (REBINT) (VAL_TIME(val) / (SEC_SEC / 1000));
-chk_neg:
-		if (timeout < 0) Trap_Range(val);
+		timeout = Timer_Usecs(val);
 		break;
 
 	case REB_PORT:
@@ -359,7 +368,7 @@ chk_neg:
 		// fall thru...
 	case REB_NONE:
 	case REB_END:
-		timeout = ALL_BITS;	// wait for all windows
+		timeout = -1;	// wait for all windows
 		break;
 
 	default:
@@ -400,22 +409,7 @@ chk_neg:
 **
 ***********************************************************************/
 {
-	REBVAL *val = D_ARG(1);
-	REBSER *port = VAL_PORT(val);
-
-	if (SERIES_TAIL(port) < STD_PORT_MAX) Crash(9910);
-
-	val = OFV(port, STD_PORT_ACTOR);
-	if (IS_NATIVE(val)) {
-		Do_Port_Action(port, A_UPDATE); // uses current stack frame
-	}
-
-	val = OFV(port, STD_PORT_AWAKE);
-	if (ANY_FUNC(val)) {
-		val = Apply_Func(0, val, D_ARG(2), 0);
-		if (!(IS_LOGIC(val) && VAL_LOGIC(val))) return R_FALSE;
-	}
-	return R_TRUE;  // wake it up
+	return Wake_Port(VAL_PORT(D_ARG(1)), D_ARG(2)) ? R_TRUE : R_FALSE;
 }
 
 
@@ -526,6 +520,58 @@ chk_neg:
 }
 
 
+/***********************************************************************
+**
+*/	REBCHR **Make_Call_Args(REBVAL *arg, REBINT *argc)
+/*
+**		Make the argument vector (NULL terminated) of a command
+**		given as a string, file or block, as for CALL. The vector
+**		and its strings are series, so use it before a recycle.
+**
+***********************************************************************/
+{
+	REBSER *ser;
+	REBCHR **argv = NULL;
+	REBINT i;
+
+	if (IS_STRING(arg)) {
+		*argc = 1;
+		ser = Make_Series(*argc + 1, sizeof(REBCHR*), FALSE);
+		argv = (REBCHR**)SERIES_DATA(ser);
+		argv[0] = Val_Str_To_OS(arg);
+	} else if (IS_BLOCK(arg)) {
+		*argc = VAL_LEN(arg);
+		if (*argc <= 0) {
+			Trap0(RE_TOO_SHORT);
+		}
+		ser = Make_Series(*argc + 1, sizeof(REBCHR*), FALSE);
+		argv = (REBCHR**)SERIES_DATA(ser);
+		for (i = 0; i < *argc; i ++) {
+			REBVAL *param = VAL_BLK_SKIP(arg, i);
+			if (IS_STRING(param)) {
+				argv[i] = Val_Str_To_OS(param);
+			} else if (IS_FILE(param)) {
+				REBSER *path = Value_To_OS_Path(param, FALSE);
+				argv[i] = (REBCHR*) SERIES_DATA(path);
+			} else {
+				Trap_Arg(param);
+			}
+		}
+	} else if (IS_FILE(arg)) {
+		REBSER *path = Value_To_OS_Path(arg, FALSE);
+		*argc = 1;
+		ser = Make_Series(*argc + 1, sizeof(REBCHR*), FALSE);
+		argv = (REBCHR**)SERIES_DATA(ser);
+		argv[0] = (REBCHR*) SERIES_DATA(path);
+	} else {
+		Trap_Arg(arg);
+	}
+	argv[*argc] = NULL;
+
+	return argv;
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(call)
@@ -658,48 +704,8 @@ chk_neg:
 	if (flag_shell) flags |= FLAG_SHELL;
 	if (flag_info) flags |= FLAG_INFO;
 
-	if (IS_STRING(arg)) {
-		REBSER * ser = NULL;
-		cmd = Val_Str_To_OS(arg);
-		argc = 1;
-		ser = Make_Series(argc + 1, sizeof(REBCHR*), FALSE);
-		argv = (REBCHR**)SERIES_DATA(ser);
-		argv[0] = cmd;
-		argv[argc] = NULL;
-	} else if (IS_BLOCK(arg)) {
-		int i = 0;
-		REBSER * ser = NULL;
-		argc = VAL_LEN(arg);
-		if (argc <= 0) {
-			Trap0(RE_TOO_SHORT);
-		}
-		ser = Make_Series(argc + 1, sizeof(REBCHR*), FALSE);
-		argv = (REBCHR**)SERIES_DATA(ser);
-		for (i = 0; i < argc; i ++) {
-			REBVAL *param = VAL_BLK_SKIP(arg, i);
-			if (IS_STRING(param)) {
-				argv[i] = Val_Str_To_OS(param);
-			} else if (IS_FILE(param)) {
-				REBSER *path = Value_To_OS_Path(param, FALSE);
-				argv[i] = (REBCHR*) SERIES_DATA(path);
-			} else {
-				Trap_Arg(param);
-			}
-		}
-		argv[argc] = NULL;
-		cmd = NULL;
-	} else if (IS_FILE(arg)) {
-		REBSER * ser = NULL;
-		REBSER *path = Value_To_OS_Path(arg, FALSE);
-		argc = 1;
-		ser = Make_Series(argc + 1, sizeof(REBCHR*), FALSE);
-		argv = (REBCHR**)SERIES_DATA(ser);
-		argv[0] = (REBCHR*) SERIES_DATA(path);
-		argv[argc] = NULL;
-		cmd = NULL;
-	} else {
-		Trap_Arg(arg);
-	}
+	argv = Make_Call_Args(arg, &argc);
+	if (IS_STRING(arg)) cmd = argv[0];
 
 	r = OS_CREATE_PROCESS(cmd, argc, argv, flags, &pid, &exit_code,
 						  input_type, os_input, input_len,
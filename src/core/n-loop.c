@@ -118,25 +118,57 @@
 
 /***********************************************************************
 **
-*/	static void Loop_Integer(REBVAL *var, REBSER* body, REBI64 start, REBI64 end, REBI64 incr)
+*/	static REBFLG Uses_Frame(REBSER *block, REBSER *frame)
 /*
+**		Return TRUE if any word of the block (deep) is bound to the
+**		frame. Loop frames are private, so if none is, the body can
+**		neither read nor write the loop variable.
+**
+***********************************************************************/
+{
+	REBVAL *val;
+
+	for (val = BLK_HEAD(block); NOT_END(val); val++) {
+		if (ANY_WORD(val) && VAL_WORD_FRAME(val) == frame) return TRUE;
+		if (ANY_BLOCK(val) && Uses_Frame(VAL_SERIES(val), frame)) return TRUE;
+	}
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Loop_Integer(REBVAL *var, REBSER* body, REBSER *frame, REBI64 start, REBI64 end, REBI64 incr)
+/*
+**		The counter is kept in a C variable. It is only written to
+**		the loop variable (and read back) when the body uses it.
+**		Each iteration counts as an evaluation, so signals are still
+**		polled for a body that does nothing (LOOP 1E9 []).
+**
 ***********************************************************************/
 {
 	REBVAL *result;
+	REBFLG used = Uses_Frame(body, frame);
 
 	VAL_SET(var, REB_INTEGER);
-	
+	VAL_INT64(var) = start;
+
 	while ((incr > 0) ? start <= end : start >= end) {
-		VAL_INT64(var) = start;
+		if (used) VAL_INT64(var) = start;
 		result = Do_Blk(body, 0);
 		if (THROWN(result) && Check_Error(result) >= 0) break;
-		if (!IS_INTEGER(var)) Trap_Type(var);
-		start = VAL_INT64(var);
-		
+		if (used) {
+			if (!IS_INTEGER(var)) Trap_Type(var);
+			start = VAL_INT64(var);
+		}
+
 		if (REB_I64_ADD_OF(start, incr, &start)) {
 			Trap0(RE_OVERFLOW);
 		}
+		POLL_SIGNALS();
 	}
+
+	if (!used) VAL_INT64(var) = start; // write back once
 }
 
 
@@ -272,9 +304,13 @@
 	REBINT tail;
 	REBINT windex;	// write
 	REBINT rindex;	// read
+	REBINT kindex;	// start of kept values not yet moved (REMOVE-EACH)
 	REBINT err;
 	REBCNT i;
 	REBCNT j;
+	REBCNT nvars;
+	REBCNT n;
+	REBFLG fast;
 
 	ASSERT2(mode >= 0 && mode < 3, RP_MISC);
 
@@ -288,15 +324,25 @@
 	SET_NONE(D_RET);
 	SET_NONE(DS_NEXT);
 
-	// If it's MAP, create result block:
+	// Plain words over a block, string, binary or vector are set in
+	// one batch, without the per-variable dispatch of the general case:
+	nvars = frame->tail - 1;
+	fast = ANY_SERIES(value) && !IS_IMAGE(value);
+	for (i = 1; fast && i < frame->tail; i++)
+		if (!IS_WORD(FRM_WORD(frame, i))) fast = FALSE;
+
+	// If it's MAP, create result block (one value per iteration):
 	if (mode == 2) {
-		out = Make_Block(VAL_LEN(value));
+		if (IS_TABLE(value)) n = Table_Rows(VAL_SERIES(value));
+		else n = (VAL_LEN(value) + nvars - 1) / nvars;
+		out = Make_Block(n);
 		Set_Block(D_RET, out);
 	}
 
 	// Get series info:
 	if (ANY_OBJECT(value)) {
 		series = VAL_OBJ_FRAME(value);
+		Unshare_Frame(series);
 		out = FRM_WORD_SERIES(series); // words (the out local reused)
 		index = 1;
 		//if (frame->tail > 3) Trap_Arg(FRM_WORD(frame, 3));
@@ -306,6 +352,10 @@
 		index = 0;
 		//if (frame->tail > 3) Trap_Arg(FRM_WORD(frame, 3));
 	}
+	else if (IS_TABLE(value)) {
+		series = VAL_SERIES(value);
+		index = 0;
+	}
 	else {
 		series = VAL_SERIES(value);
 		index  = VAL_INDEX(value);
@@ -317,16 +367,43 @@
 		}
 	}
 
-	windex = index;
+	windex = kindex = index;
 
 	// Iterate over each value in the series block:
-	while (index < (tail = SERIES_TAIL(series))) {
+	while (index < (tail = IS_TABLE(value) ? Table_Rows(series) : SERIES_TAIL(series))) {
 
 		rindex = index;  // remember starting spot
 		j = 0;
 
+		if (fast) {
+			vars = FRM_VALUE(frame, 1);
+			n = MIN(nvars, (REBCNT)(tail - index));
+			if (ANY_BLOCK(value))
+				memcpy(vars, BLK_SKIP(series, index), n * sizeof(REBVAL));
+			else if (IS_VECTOR(value)) {
+				for (i = 0; i < n; i++) Set_Vector_Value(vars + i, series, index + i);
+			}
+			else if (IS_BINARY(value)) {
+				for (i = 0; i < n; i++) SET_INTEGER(vars + i, BIN_HEAD(series)[index + i]);
+			}
+			else if (BYTE_SIZE(series)) {
+				for (i = 0; i < n; i++) {
+					VAL_SET(vars + i, REB_CHAR);
+					VAL_CHAR(vars + i) = BIN_HEAD(series)[index + i];
+				}
+			}
+			else {
+				for (i = 0; i < n; i++) {
+					VAL_SET(vars + i, REB_CHAR);
+					VAL_CHAR(vars + i) = UNI_HEAD(series)[index + i];
+				}
+			}
+			for (i = n; i < nvars; i++) SET_NONE(vars + i);
+			index += n;
+		}
+
 		// Set the FOREACH loop variables from the series:
-		for (i = 1; i < frame->tail; i++) {
+		else for (i = 1; i < frame->tail; i++) {
 
 			vars = FRM_VALUE(frame, i);
 			words = FRM_WORD(frame, i);
@@ -364,6 +441,12 @@
 						Set_Vector_Value(vars, series, index);
 					}
 
+					else if (IS_TABLE(value)) {
+						// Bind the columns of a row, without a row block:
+						Table_Cell(series, j++, index, vars);
+						continue; // the row advances below
+					}
+
 					else if (IS_MAP(value)) {
 						REBVAL *val = BLK_SKIP(series, index | 1);
 						if (!IS_NONE(val)) {
@@ -402,7 +485,7 @@
 
 			// var spec is SET_WORD:
 			else if (IS_SET_WORD(words)) {
-				if (ANY_OBJECT(value) || IS_MAP(value)) {
+				if (ANY_OBJECT(value) || IS_MAP(value) || IS_TABLE(value)) {
 					*vars = *value;
 				} else {
 					VAL_SET(vars, REB_BLOCK);
@@ -431,14 +514,22 @@
 		if (mode > 0) {
 			//if (ANY_OBJECT(value)) Trap_Types(words, REB_BLOCK, VAL_TYPE(value)); //check not needed
 
-			// If FALSE return, copy values to the write location:
+			// If TRUE return, the values are removed. Runs of kept values
+			// are moved down once, when the next removal ends the run:
 			if (mode == 1) {  // remove-each
-				if (IS_FALSE(ds)) {
-					REBCNT wide = SERIES_WIDE(series);
-					// memory areas may overlap, so use memmove and not memcpy!
-					memmove(series->data + (windex * wide), series->data + (rindex * wide), (index - rindex) * wide);
-					windex += index - rindex;
-					// old: while (rindex < index) *BLK_SKIP(series, windex++) = *BLK_SKIP(series, rindex++);
+				if (!IS_FALSE(ds)) {
+					// The body may have shortened the series:
+					tail = SERIES_TAIL(series);
+					if (rindex > tail) rindex = tail;
+					if (kindex > rindex) kindex = rindex;
+					if (windex > kindex) windex = kindex;
+					if (windex < kindex) {
+						REBCNT wide = SERIES_WIDE(series);
+						// memory areas may overlap, so use memmove and not memcpy!
+						memmove(series->data + (windex * wide), series->data + (kindex * wide), (rindex - kindex) * wide);
+					}
+					windex += rindex - kindex;
+					kindex = index;
 				}
 			}
 			else
@@ -449,7 +540,16 @@ skip_hidden: ;
 
 	// Finish up:
 	if (mode == 1) {
-		// Remove hole (updates tail):
+		// Move the last run of kept values, then remove the hole (updates tail):
+		tail = SERIES_TAIL(series);
+		if (index > tail) index = tail;
+		if (kindex > index) kindex = index;
+		if (windex > kindex) windex = kindex;
+		if (windex < kindex) {
+			REBCNT wide = SERIES_WIDE(series);
+			memmove(series->data + (windex * wide), series->data + (kindex * wide), (index - kindex) * wide);
+		}
+		windex += index - kindex;
 		if (windex < index) Remove_Series(series, windex, index - windex);
 		SET_INTEGER(DS_RETURN, index - windex);
 		return R_RET;
@@ -489,7 +589,7 @@ skip_hidden: ;
 	// values must not be absolute.
 
 	if (IS_INTEGER(start) && IS_INTEGER(end) && IS_INTEGER(incr)) {
-		Loop_Integer(var, body, VAL_INT64(start), 
+		Loop_Integer(var, body, frame, VAL_INT64(start), 
 			IS_DECIMAL(end) ? (REBI64)VAL_DECIMAL(end) : VAL_INT64(end), VAL_INT64(incr));
 	}
 	else if (ANY_SERIES(start)) {
@@ -602,6 +702,7 @@ skip_hidden: ;
 		if (THROWN(ds)) {
 			if (Check_Error(ds) >= 0) break;
 		}
+		POLL_SIGNALS();
 	}
 	if (ds) return R_TOS1;
 	return R_NONE;
@@ -639,7 +740,7 @@ skip_hidden: ;
 		Loop_Series(var, body, count, VAL_TAIL(count)-1, 1);
 	}
 	else if (IS_INTEGER(count)) {
-		Loop_Integer(var, body, 1, VAL_INT64(count), 1);
+		Loop_Integer(var, body, frame, 1, VAL_INT64(count), 1);
 	}
 
 	return R_TOS1;
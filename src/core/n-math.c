@@ -285,6 +285,110 @@ enum {SINE, COSINE, TANGENT};
 }
 
 
+/***********************************************************************
+**
+*/	REBNATIVE(sum)
+/*
+***********************************************************************/
+{
+	if (D_REF(2) && D_REF(3)) Trap0(RE_BAD_REFINES);
+	if (IS_BLOCK(D_ARG(1))) {
+		if (D_REF(2) || D_REF(3)) Trap0(RE_BAD_REFINES);
+		Sum_Money_Block(D_ARG(1), D_RET);
+	}
+	else if (D_REF(2) || D_REF(3)) Reduce_Matrix(D_ARG(1), 0, D_REF(3), D_RET);
+	else Sum_Vector(D_ARG(1), D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(mean)
+/*
+***********************************************************************/
+{
+	if (D_REF(2) && D_REF(3)) Trap0(RE_BAD_REFINES);
+	if (D_REF(2) || D_REF(3)) Reduce_Matrix(D_ARG(1), 1, D_REF(3), D_RET);
+	else Mean_Vector(D_ARG(1), D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(min_of)
+/*
+***********************************************************************/
+{
+	if (D_REF(2) && D_REF(3)) Trap0(RE_BAD_REFINES);
+	if (D_REF(2) || D_REF(3)) Reduce_Matrix(D_ARG(1), 2, D_REF(3), D_RET);
+	else Min_Max_Vector(D_ARG(1), FALSE, D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(max_of)
+/*
+***********************************************************************/
+{
+	if (D_REF(2) && D_REF(3)) Trap0(RE_BAD_REFINES);
+	if (D_REF(2) || D_REF(3)) Reduce_Matrix(D_ARG(1), 3, D_REF(3), D_RET);
+	else Min_Max_Vector(D_ARG(1), TRUE, D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(dot)
+/*
+***********************************************************************/
+{
+	if (IS_BLOCK(D_ARG(1)) != IS_BLOCK(D_ARG(2))) Trap_Arg(D_ARG(2));
+	if (IS_BLOCK(D_ARG(1))) Dot_Money_Block(D_ARG(1), D_ARG(2), D_RET);
+	else Dot_Vector(D_ARG(1), D_ARG(2), D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(transpose)
+/*
+***********************************************************************/
+{
+	Transpose_Vector(D_ARG(1), D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(reshape)
+/*
+***********************************************************************/
+{
+	REBVAL *size = D_ARG(2);
+	REBINT cols = 0;
+
+	if (IS_PAIR(size)) {
+		cols = VAL_PAIR_X_INT(size);
+		if (cols <= 0 || VAL_PAIR_Y_INT(size) < 0
+			|| (REBI64)cols * VAL_PAIR_Y_INT(size) != VAL_LEN(D_ARG(1))
+		) Trap_Arg(size);
+	}
+	else if (IS_INTEGER(size)) {
+		cols = Int32s(size, 0);
+	}
+
+	Reshape_Vector(D_ARG(1), cols);
+	return R_ARG1;
+}
+
+
 /***********************************************************************
 **
 */	REBINT Compare_Values(REBVAL *a, REBVAL *b, REBINT strictness)
@@ -570,3 +674,99 @@ compare:
 	}
 	return R_FALSE;
 }
+
+
+/***********************************************************************
+**
+*/	static REBINT Compare_Mode(REBVAL *func, REBFLG *invert)
+/*
+**		Map a comparator to a mode of Mask_Vector. The comparator is
+**		identified by its native code, so both the functions (LESSER?)
+**		and their ops (<) are accepted.
+**
+***********************************************************************/
+{
+	REBFUN code = VAL_FUNC_CODE(func);
+
+	*invert = FALSE;
+	if (code == N_equalq || code == N_equivq || code == N_strict_equalq) return 0;
+	if (code == N_not_equalq || code == N_not_equivq || code == N_strict_not_equalq) {*invert = TRUE; return 0;}
+	if (code == N_greater_or_equalq) return -1;
+	if (code == N_lesserq) {*invert = TRUE; return -1;}
+	if (code == N_greaterq) return -2;
+	if (code == N_lesser_or_equalq) {*invert = TRUE; return -2;}
+	Trap_Arg(func);
+	DEAD_END;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(mask)
+/*
+**		vector comparator value
+**
+***********************************************************************/
+{
+	REBFLG invert;
+	REBINT mode = Compare_Mode(D_ARG(2), &invert);
+
+	Mask_Vector(D_ARG(1), D_ARG(3), mode, invert, D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(filter)
+/*
+**		table column comparator value
+**
+***********************************************************************/
+{
+	REBFLG invert;
+	REBINT mode = Compare_Mode(D_ARG(3), &invert);
+
+	Filter_Table(D_ARG(1), D_ARG(2), mode, invert, D_ARG(4), D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(order_by)
+/*
+**		table column /reverse
+**
+***********************************************************************/
+{
+	Sort_Table(D_ARG(1), D_ARG(2), D_REF(3), D_RET);
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(group_by)
+/*
+**		table key column aggregate
+**
+**		The aggregate is identified by its native code, as for MASK.
+**
+***********************************************************************/
+{
+	REBVAL *func = D_ARG(4);
+	REBFUN code = VAL_FUNC_CODE(func);
+	REBCNT agg = 0;
+
+	if (IS_ACTION(func) && VAL_FUNC_ACT(func) == A_LENGTHQ) agg = AGG_COUNT;
+	else if (!IS_NATIVE(func)) Trap_Arg(func);
+	else if (code == N_sum) agg = AGG_SUM;
+	else if (code == N_mean) agg = AGG_MEAN;
+	else if (code == N_min_of) agg = AGG_MIN;
+	else if (code == N_max_of) agg = AGG_MAX;
+	else Trap_Arg(func);
+
+	Group_Table(D_ARG(1), D_ARG(2), D_ARG(3), agg, D_RET);
+	return R_RET;
+}
@@ -101,11 +101,14 @@ static struct digest {
 ***********************************************************************/
 {
 	REBSER *str;
+	REBVAL into = *D_ARG(3); // (stack may move while reducing)
 
-	str = Form_Reduce(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)));
+	str = Form_Reduce(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)), IS_NONE(&into) ? 0 : &into);
 	if (!str) return R_TOS;
 
-	Set_String(DS_RETURN, str); // not D_RET (stack modified)
+	// not D_RET (stack modified)
+	if (IS_NONE(&into)) Set_String(DS_RETURN, str);
+	else *DS_RETURN = into;
 
 	return R_RET;
 }
@@ -707,6 +710,7 @@ static struct digest {
 	REBVAL *arg = D_ARG(1);
 	REBINT n;
 
+	Unview_Binary(arg);
 	n = What_UTF(VAL_BIN_DATA(arg), VAL_LEN(arg));
 
 	if (n != 0 && n != 8) return R_NONE;  // UTF8 only
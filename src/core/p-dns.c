@@ -29,6 +29,44 @@
 
 #include "sys-core.h"
 #include "reb-net.h"
+#include "reb-evtypes.h"
+
+
+/***********************************************************************
+**
+*/	REBSER *Form_IPv6(REBYTE *addr)
+/*
+**		Form an IPv6 address as text (RFC 5952): the longest run
+**		of zero groups is shortened to ::.
+**
+***********************************************************************/
+{
+	REBYTE buf[48];
+	REBYTE *cp = buf;
+	REBINT run = -1, len = 0;
+	REBINT n, m, group;
+
+	for (n = 0; n < 8; n = m + 1) {
+		for (m = n; m < 8 && !addr[m*2] && !addr[m*2+1]; m++);
+		if (m - n > len && m - n > 1) {run = n; len = m - n;}
+	}
+
+	for (n = 0; n < 8; n++) {
+		if (n == run) {
+			*cp++ = ':';
+			if (n == 0) *cp++ = ':';
+			n += len - 1;
+			continue;
+		}
+		group = addr[n*2] << 8 | addr[n*2+1];
+		for (m = 12; m > 0 && !(group >> m); m -= 4);
+		for (; m >= 0; m -= 4) *cp++ = "0123456789abcdef"[(group >> m) & 15];
+		if (n < 7) *cp++ = ':';
+	}
+	*cp = 0;
+
+	return Copy_Bytes(buf, cp - buf);
+}
 
 
 /***********************************************************************
@@ -42,8 +80,9 @@
 	REBINT result;
 	REBVAL *arg;
 	REBCNT len;
+	REBI64 base;
 	REBOOL sync = FALSE; // act synchronously
-	REBVAL tmp;
+	REBDNS *dns;
 
 	Validate_Port(port, action);
 
@@ -54,7 +93,9 @@
 	spec = OFV(port, STD_PORT_SPEC);
 	if (!IS_OBJECT(spec)) Trap0(RE_INVALID_PORT);
 
-	sock->timeout = 4000; // where does this go? !!!
+	// The resolver times out lookups itself:
+	len = (REBCNT)(Timer_Usecs(Obj_Value(spec, STD_PORT_SPEC_NET_TIMEOUT)) / 1000);
+	sock->timeout = (len > 0 && len < MAX_I32) ? len : 4000;
 
 	switch (action) {
 
@@ -66,11 +107,12 @@
 
 		arg = Obj_Value(spec, STD_PORT_SPEC_NET_HOST);
 
-		if (IS_TUPLE(arg) && Scan_Tuple(VAL_BIN(arg), strlen(VAL_BIN(arg)), &tmp)) {
+		if (IS_TUPLE(arg) && VAL_TUPLE_LEN(arg) == 4) {
 			SET_FLAG(sock->modes, RST_REVERSE);
-			memcpy(&sock->net.remote_ip, VAL_TUPLE(&tmp), 4);
+			memcpy(&sock->net.remote_ip, VAL_TUPLE(arg), 4);
 		}
 		else if (IS_STRING(arg)) {
+			CLR_FLAG(sock->modes, RST_REVERSE);
 			sock->data = VAL_BIN(arg);
 		}
 		else Trap_Port(RE_INVALID_SPEC, port, -10);
@@ -78,17 +120,23 @@
 		result = OS_DO_DEVICE(sock, RDC_READ);
 		if (result < 0) Trap_Port(RE_READ_ERROR, port, sock->error);
 
-		// Wait for it...
+		// Wait for it (in short steps, as the lookup times out itself)...
 		if (sync && result == DR_PEND) {
-			for (len = 0; GET_FLAG(sock->flags, RRF_PENDING) && len < 10; len++) {
-				OS_WAIT(2000, 0);
+			base = OS_DELTA_TIME(0, 0);
+			while (GET_FLAG(sock->flags, RRF_PENDING) && OS_DELTA_TIME(base, 0) < (REBI64)sock->timeout * 1000) {
+				OS_WAIT(10000, 0);
 			}
 			len = 1;
 			goto pick;
 		}
 		if (result == DR_DONE) {
-			len = 1;
-			goto pick;
+			if (sync) {
+				len = 1;
+				goto pick;
+			}
+			// Answered at once (address, hosts, or cache), so
+			// signal the awake as a pending lookup would:
+			Signal_Read(sock);
 		}
 		break;
 
@@ -99,13 +147,19 @@ pick:
 		if (len == 1) {
 			if (!sock->net.host_info || !GET_FLAG(sock->flags, RRF_DONE)) return R_NONE;
 			if (sock->error) {
+				len = sock->error; // (close clears it)
 				OS_DO_DEVICE(sock, RDC_CLOSE);
-				Trap_Port(RE_READ_ERROR, port, sock->error);
+				Trap_Port(RE_READ_ERROR, port, len);
 			}
+			dns = (REBDNS*)sock->net.host_info;
 			if (GET_FLAG(sock->modes, RST_REVERSE)) {
-				Set_String(D_RET, Copy_Bytes(sock->data, LEN_BYTES(sock->data)));
+				Set_String(D_RET, Copy_Bytes(dns->name, LEN_BYTES(dns->name)));
+			} else if (dns->count == 0) {
+				SET_NONE(D_RET);
+			} else if (dns->addrs[0].family == 4) {
+				Set_Tuple(D_RET, dns->addrs[0].addr, 4);
 			} else {
-				Set_Tuple(D_RET, (REBYTE*)&sock->net.remote_ip, 4);
+				Set_String(D_RET, Form_IPv6(dns->addrs[0].addr));
 			}
 			OS_DO_DEVICE(sock, RDC_CLOSE);
 		} else Trap_Range(arg);
@@ -116,6 +170,7 @@ pick:
 		break;
 
 	case A_CLOSE:
+		Cancel_Timer(sock); // a read event not yet signalled
 		OS_DO_DEVICE(sock, RDC_CLOSE);
 		break;
 
@@ -56,9 +56,10 @@
 
 #include "sys-core.h"
 
-REBREQ *req;		//!!! move this global
+INSTANCE REBREQ *req;		//!!! move this global
 
 #define EVENTS_LIMIT 0xFFFF //64k
+#define EVENTS_HIGH  (EVENTS_LIMIT / 2) // stop polling devices above this
 #define EVENTS_CHUNK 128
 
 /***********************************************************************
@@ -72,6 +73,13 @@ REBREQ *req;		//!!! move this global
 **		so do NOT extend the event queue here. If it does not have
 **		space, return 0. (Should it overwrite or wrap???)
 **
+**		The queue is a block that is consumed from its head, which
+**		only moves the series bias, so it works as a ring buffer.
+**		When it reaches EVENTS_LIMIT the event is refused (return 0)
+**		rather than crashing. WAIT stops polling devices well before
+**		that (see Event_Backlog), so devices hold their pending I/O
+**		until the queue drains.
+**
 ***********************************************************************/
 {
 	REBVAL *port;
@@ -87,12 +95,9 @@ REBREQ *req;		//!!! move this global
 
 	// Append to tail if room:
 	if (SERIES_FULL(VAL_SERIES(state))) {
-		if (VAL_TAIL(state) > EVENTS_LIMIT) {
-			Crash(RP_MAX_EVENTS);
-		} else {
-			Extend_Series(VAL_SERIES(state), EVENTS_CHUNK);
-			//RL_Print("event queue increased to :%d\n", SERIES_REST(VAL_SERIES(state)));
-		}
+		if (VAL_TAIL(state) > EVENTS_LIMIT) return 0;
+		Extend_Series(VAL_SERIES(state), EVENTS_CHUNK);
+		//RL_Print("event queue increased to :%d\n", SERIES_REST(VAL_SERIES(state)));
 	}
 	VAL_TAIL(state)++;
 	value = VAL_BLK_TAIL(state);
@@ -105,6 +110,29 @@ REBREQ *req;		//!!! move this global
 
 	return value;
 }
+
+
+/***********************************************************************
+**
+*/	REBFLG Event_Backlog(void)
+/*
+**		Return TRUE if the event queue is backlogged. WAIT then
+**		dispatches the queued events without polling the devices
+**		for more (backpressure).
+**
+***********************************************************************/
+{
+	REBVAL *port;
+	REBVAL *state;
+
+	port = Get_System(SYS_PORTS, PORTS_SYSTEM);
+	if (!IS_PORT(port)) return FALSE;
+
+	state = VAL_BLK_SKIP(port, STD_PORT_STATE);
+	return IS_BLOCK(state) && VAL_TAIL(state) >= EVENTS_HIGH;
+}
+
+
 /***********************************************************************
 **
 */	REBVAL *Find_Last_Event (REBINT model, REBINT type)
@@ -240,3 +268,17 @@ act_blk:
 	Register_Scheme(SYM_EVENT, 0, Event_Actor);
 	Register_Scheme(SYM_CALLBACK, 0, Event_Actor);
 }
+
+
+/***********************************************************************
+**
+*/	void Dispose_Event_Scheme(void)
+/*
+***********************************************************************/
+{
+	if (req) {
+		OS_ABORT_DEVICE(req);
+		OS_FREE(req);
+		req = 0;
+	}
+}
@@ -39,6 +39,24 @@ enum Transport_Types {
 	TRANSPORT_UDP
 };
 
+/***********************************************************************
+**
+*/	static void Set_IP(REBVAL *val, REBREQ *sock, u32 *ip, REBYTE *ip6)
+/*
+**		An IPv4 address is a tuple, an IPv6 address is a string.
+**		IPv4 peers of IPv6 sockets (::ffff:a.b.c.d) are IPv4.
+**
+***********************************************************************/
+{
+	static const REBYTE mapped[12] = {0,0,0,0,0,0,0,0,0,0,0xff,0xff};
+
+	if (GET_FLAG(sock->modes, RST_IPV6) && memcmp(ip6, mapped, 12))
+		Set_String(val, Form_IPv6(ip6));
+	else
+		Set_Tuple(val, (REBYTE*)ip, 4);
+}
+
+
 /***********************************************************************
 **
 */	static void Ret_Query_Net(REBSER *port, REBREQ *sock, REBVAL *ret)
@@ -53,8 +71,8 @@ enum Transport_Types {
 	obj = CLONE_OBJECT(VAL_OBJ_FRAME(info));
 
 	SET_OBJECT(ret, obj);
-	Set_Tuple(OFV(obj, STD_NET_INFO_LOCAL_IP), (REBYTE*)&sock->net.local_ip, 4);
-	Set_Tuple(OFV(obj, STD_NET_INFO_REMOTE_IP), (REBYTE*)&sock->net.remote_ip, 4);
+	Set_IP(OFV(obj, STD_NET_INFO_LOCAL_IP), sock, &sock->net.local_ip, sock->net.local_ip6);
+	Set_IP(OFV(obj, STD_NET_INFO_REMOTE_IP), sock, &sock->net.remote_ip, sock->net.remote_ip6);
 	SET_INTEGER(OFV(obj, STD_NET_INFO_LOCAL_PORT), sock->net.local_port);
 	SET_INTEGER(OFV(obj, STD_NET_INFO_REMOTE_PORT), sock->net.remote_port);
 }
@@ -144,6 +162,7 @@ enum Transport_Types {
 				sock->net.remote_port = IS_INTEGER(val) ? VAL_INT32(val) : 80;
 				result = OS_DO_DEVICE(sock, RDC_LOOKUP);  // sets remote_ip field
 				if (result < 0) Trap_Port(RE_NO_CONNECT, port, sock->error);
+				Set_Port_Timeout(sock, Obj_Value(spec, STD_PORT_SPEC_NET_TIMEOUT));
 				return R_RET;
 			}
 
@@ -216,6 +235,7 @@ enum Transport_Types {
 		//Print("(max read length %d)", sock->length);
 		result = OS_DO_DEVICE(sock, RDC_READ); // recv can happen immediately
 		if (result < 0) Trap_Port(RE_READ_ERROR, port, sock->error);
+		Set_Port_Timeout(sock, Obj_Value(spec, STD_PORT_SPEC_NET_TIMEOUT));
 		break;
 
 	case A_WRITE:
@@ -245,6 +265,7 @@ enum Transport_Types {
 		result = OS_DO_DEVICE(sock, RDC_WRITE); // send can happen immediately
 		if (result < 0) Trap_Port(RE_WRITE_ERROR, port, sock->error);
 		if (result == DR_DONE) SET_NONE(OFV(port, STD_PORT_DATA));
+		else Set_Port_Timeout(sock, Obj_Value(OFV(port, STD_PORT_SPEC), STD_PORT_SPEC_NET_TIMEOUT));
 		break;
 
 	case A_PICK:
@@ -268,6 +289,7 @@ enum Transport_Types {
 		return R_FALSE;
 
 	case A_CLOSE:
+		Cancel_Timer(sock);
 		if (IS_OPEN(sock)) {
             if (OS_DO_DEVICE(sock, RDC_CLOSE) < 0) {
                 Trap_Port(RE_CANNOT_CLOSE, port, sock->error);
@@ -285,12 +307,15 @@ enum Transport_Types {
 	case A_OPEN:
 		result = OS_DO_DEVICE(sock, RDC_CONNECT);
 		if (result < 0) Trap_Port(RE_NO_CONNECT, port, sock->error);
+		if (!GET_FLAG(sock->modes, RST_LISTEN))
+			Set_Port_Timeout(sock, Obj_Value(spec, STD_PORT_SPEC_NET_TIMEOUT));
 		break;
 		//Trap_Port(RE_ALREADY_OPEN, port);
 
 	case A_DELETE: // Temporary to TEST error handler!
 		{
 			REBVAL *event = Append_Event();		// sets signal
+			if (!event) break;				// queue is full
 			VAL_SET(event, REB_EVENT);		// (has more space, if we need it)
 			VAL_EVENT_TYPE(event) = EVT_ERROR;
 			VAL_EVENT_DATA(event) = 101;
@@ -0,0 +1,204 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  p-process.c
+**  Summary: process port interface
+**  Section: ports
+**  Notes:
+**     A process port runs a command (as CALL does) with its stdin
+**     and stdout on pipes that are served from the event loop. Each
+**     READ asks for the next output chunk, which is appended to the
+**     port data by a READ event; the end of the output is a CLOSE
+**     event. WRITE queues data for stdin, which is fed as the child
+**     takes it (a WROTE event when the queue is empty); an empty
+**     WRITE closes stdin. QUERY gives the process id and
+**     exit code, also after a CLOSE (which does not kill the child).
+**
+***********************************************************************/
+/*
+	General idea of usage:
+
+	p: open [scheme: 'process command: ["sort" "-r"]]
+	p/awake: func [event] [
+		switch event/type [
+			wrote [write event/port ""]	; done, close stdin
+			read [read event/port]		; data is in port/data
+			close [return true]
+		]
+		false
+	]
+	write p "a^/b^/"
+	read p
+	wait [p 10]
+	print to string! p/data
+	close p
+	probe query p	; id and exit-code
+*/
+
+#include "sys-core.h"
+#include "reb-evtypes.h"
+
+#ifdef HAS_POSIX_PROCESS
+
+#define READ_SIZE 32768	// most output to take in one READ event
+
+
+/***********************************************************************
+**
+*/	static int Process_Actor(REBVAL *ds, REBSER *port, REBCNT action)
+/*
+***********************************************************************/
+{
+	REBREQ *req;
+	REBINT result;
+	REBVAL *arg;
+	REBVAL *spec;
+	REBVAL *val;
+	REBSER *ser;
+	REBCNT len;
+	REBINT argc;
+
+	Validate_Port(port, action);
+
+	*D_RET = *D_ARG(1);
+	arg = D_ARG(2);
+
+	req = Use_Port_State(port, RDI_PROCESS, sizeof(REBREQ));
+	spec = OFV(port, STD_PORT_SPEC);
+	if (!IS_OBJECT(spec)) Trap0(RE_INVALID_PORT);
+
+	if (!IS_OPEN(req)) {
+		switch (action) {
+		case A_OPEN:
+			val = Obj_Value(spec, STD_PORT_SPEC_PROCESS_COMMAND);
+			if (!IS_STRING(val) && !IS_FILE(val) && !IS_BLOCK(val))
+				Trap1(RE_INVALID_SPEC, val);
+			Check_Security(SYM_CALL, POL_EXEC, val);
+
+			req->modes = 0;
+			if (IS_TRUE(Obj_Value(spec, STD_PORT_SPEC_PROCESS_SHELL)))
+				SET_FLAG(req->modes, RPM_SHELL);
+			arg = Obj_Value(spec, STD_PORT_SPEC_PROCESS_ERROR);
+			if (IS_WORD(arg) && VAL_WORD_CANON(arg) == SYM_OUTPUT)
+				SET_FLAG(req->modes, RPM_MERGE);
+			else if (!IS_NONE(arg))
+				Trap1(RE_INVALID_SPEC, arg);
+
+			// The device starts it from the argument vector:
+			req->data = (REBYTE*)Make_Call_Args(val, &argc);
+			req->length = argc;
+			if (OS_DO_DEVICE(req, RDC_OPEN)) Trap_Port(RE_CANNOT_OPEN, port, req->error);
+			SET_NONE(OFV(port, STD_PORT_DATA));
+			return R_RET;
+
+		case A_CLOSE:
+			return R_RET;
+
+		case A_OPENQ:
+			return R_FALSE;
+
+		case A_QUERY:	// allowed after a close
+		case A_UPDATE:
+			break;
+
+		default:
+			Trap_Port(RE_NOT_OPEN, port, -12);
+		}
+	}
+
+	switch (action) {
+
+	case A_UPDATE:
+		// Take the output of a READ event (its buffer is only valid
+		// while the port is open):
+		if (IS_EVENT(arg) && VAL_EVENT_TYPE(arg) == EVT_READ
+			&& IS_OPEN(req) && req->process.count > 0) {
+			val = OFV(port, STD_PORT_DATA);
+			if (!IS_BINARY(val)) Set_Binary(val, Make_Binary(req->process.count));
+			Append_Bytes_Len(VAL_SERIES(val), req->process.output, req->process.count);
+			req->process.count = 0;
+		}
+		return R_NONE;
+
+	case A_READ:
+		// Ask for the next output chunk (a READ or CLOSE event):
+		req->length = READ_SIZE;
+		result = OS_DO_DEVICE(req, RDC_READ);
+		if (result < 0) Trap_Port(RE_READ_ERROR, port, req->error);
+		break;
+
+	case A_WRITE:
+		// Queue the data for stdin (the device copies it):
+		len = VAL_LEN(arg);
+		if (IS_STRING(arg)) {
+			ser = Encode_UTF8_Value(arg, len, 0);
+			req->data = BIN_HEAD(ser);
+			req->length = SERIES_TAIL(ser);
+		}
+		else if (IS_BINARY(arg)) {
+			req->data = VAL_BIN_DATA(arg);
+			req->length = len;
+		}
+		else Trap_Arg(arg);
+		result = OS_DO_DEVICE(req, RDC_WRITE);
+		if (result < 0) Trap_Port(RE_WRITE_ERROR, port, req->error);
+		break;
+
+	case A_QUERY:
+		if (!req->process.pid) return R_NONE; // never opened
+		if (IS_OPEN(req)) OS_DO_DEVICE(req, RDC_QUERY);
+		ser = Make_Frame(2);
+		val = Append_Frame(ser, NULL, SYM_ID);
+		SET_INTEGER(val, req->process.pid);
+		val = Append_Frame(ser, NULL, SYM_EXIT_CODE);
+		if (req->process.exit_code < 0) SET_NONE(val);
+		else SET_INTEGER(val, req->process.exit_code);
+		SET_OBJECT(D_RET, ser);
+		break;
+
+	case A_CLOSE:
+		OS_DO_DEVICE(req, RDC_CLOSE);
+		break;
+
+	case A_OPENQ:
+		return R_TRUE;
+
+	case A_OPEN:
+		Trap1(RE_ALREADY_OPEN, D_ARG(1));
+
+	default:
+		Trap_Action(REB_PORT, action);
+	}
+
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	void Init_Process_Scheme(void)
+/*
+***********************************************************************/
+{
+	Register_Scheme(SYM_PROCESS, 0, Process_Actor);
+}
+
+#endif //HAS_POSIX_PROCESS
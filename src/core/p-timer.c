@@ -20,94 +20,495 @@
 ************************************************************************
 **
 **  Module:  p-timer.c
-**  Summary: timer port interface
+**  Summary: timer port interface and timer wheel
 **  Section: ports
 **  Author:  Carl Sassenrath
-**  Notes:   NOT IMPLEMENTED
+**  Notes:
+**     Timers are kept in a hierarchical wheel of WHEEL_LEVELS levels,
+**     each of WHEEL_SLOTS slots. A level 0 slot is one microsecond,
+**     and each level above spans a whole turn of the one below. A
+**     timer sits in the lowest level that reaches its due time, so
+**     arming and cancelling are a list link and unlink. As the wheel
+**     advances, the slots passed over are emptied: due timers fire,
+**     and the rest drop to a lower level (a cascade).
+**
+**     Each timer times a request (REBREQ), which links back to it
+**     by its timer field. Timer ports own their request; network
+**     ports are timed by their spec/timeout (see Set_Port_Timeout).
 **
 ***********************************************************************/
 /*
 	General idea of usage:
 
 	t: open timer://name
-	write t 10	; set timer - also allow: 1.23 1:23
+	write t [10]	; set timer - also allow: 1.23 1:23
 	wait t
-	clear t		; reset or delete?
-	read t		; get timer value
-	t/awake: func [event] [print "timer!"]
-	one-shot vs restart timer
+	read t		; get time left (none when not set)
+	clear t		; cancel it (as does: write t [])
+	t/awake: func [event] [print "timer!" write event/port [10] true]
+
+	(WRITE takes the time in a block, as its data cannot be a number.)
 */
 
 #include "sys-core.h"
+#include "reb-evtypes.h"
+
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS 7	// 2^42 usecs (about 50 days), farther is clamped
+
+enum {
+	TMR_PORT,		// timer port: signals a time event
+	TMR_TIMEOUT,	// I/O request: aborts it if still pending
+	TMR_READ,		// finished request: signals its read event
+};
+
+typedef struct rebol_timer {
+	struct rebol_timer *next;
+	struct rebol_timer *prev;
+	REBI64 due;		// expiry time in usecs (wheel time)
+	REBREQ *req;	// the request it times (holds the port)
+	REBCNT type;	// TMR_ enum
+	REBCNT slot;	// level * WHEEL_SLOTS + slot
+} REBTMR;
+
+INSTANCE REBTMR *Wheel[WHEEL_LEVELS * WHEEL_SLOTS];
+INSTANCE REBU64 Wheel_Used[WHEEL_LEVELS];	// bitmap of non-empty slots
+INSTANCE REBI64 Wheel_Time;	// time the wheel has advanced to
+INSTANCE REBI64 Wheel_Base;	// OS counter at wheel time zero
 
 
 /***********************************************************************
 **
-*/	static int Event_Actor(REBVAL *ds, REBSER *port, REBCNT action)
+*/	static REBI64 Timer_Now(void)
 /*
+**		Current wheel time in microseconds.
+**
 ***********************************************************************/
 {
-	REBVAL *spec;
-	REBVAL *state;
-	REBCNT result;
+	return OS_DELTA_TIME(Wheel_Base, 0);
+}
+
+
+/***********************************************************************
+**
+*/	static void Link_Timer(REBTMR *tmr)
+/*
+**		Put the timer in the slot of the lowest level that reaches
+**		its due time. Due times already passed go to the current
+**		level 0 slot, so they fire on the next advance.
+**
+***********************************************************************/
+{
+	REBI64 due = MAX(tmr->due, Wheel_Time);
+	REBI64 tick;
+	REBCNT level;
+	REBCNT n;
+
+	for (level = 0; level < WHEEL_LEVELS - 1; level++) {
+		if ((due >> (level * WHEEL_BITS)) - (Wheel_Time >> (level * WHEEL_BITS)) < WHEEL_SLOTS) break;
+	}
+	tick = due >> (level * WHEEL_BITS);
+	if (tick - (Wheel_Time >> (level * WHEEL_BITS)) >= WHEEL_SLOTS)
+		tick = (Wheel_Time >> (level * WHEEL_BITS)) + WHEEL_MASK; // clamped
+
+	n = (REBCNT)(tick & WHEEL_MASK);
+	tmr->slot = level * WHEEL_SLOTS + n;
+	tmr->prev = 0;
+	tmr->next = Wheel[tmr->slot];
+	if (tmr->next) tmr->next->prev = tmr;
+	Wheel[tmr->slot] = tmr;
+	Wheel_Used[level] |= (REBU64)1 << n;
+}
+
+
+/***********************************************************************
+**
+*/	static void Unlink_Timer(REBTMR *tmr)
+/*
+***********************************************************************/
+{
+	if (tmr->prev) tmr->prev->next = tmr->next;
+	else {
+		Wheel[tmr->slot] = tmr->next;
+		if (!tmr->next)
+			Wheel_Used[tmr->slot / WHEEL_SLOTS] &= ~((REBU64)1 << (tmr->slot & WHEEL_MASK));
+	}
+	if (tmr->next) tmr->next->prev = tmr->prev;
+	tmr->next = tmr->prev = 0;
+}
+
+
+/***********************************************************************
+**
+*/	void Set_Timer(REBREQ *req, REBI64 usecs, REBCNT type)
+/*
+**		Arm the timer of a request to expire usecs from now.
+**		A timer already armed is moved to the new time.
+**
+***********************************************************************/
+{
+	REBTMR *tmr = req->timer;
+
+	if (tmr) Unlink_Timer(tmr);
+	else {
+		tmr = Make_Mem(sizeof(REBTMR));
+		if (!tmr) Trap0(RE_NO_MEMORY);
+		tmr->req = req;
+		req->timer = tmr;
+	}
+	tmr->type = type;
+	tmr->due = Timer_Now() + usecs;
+	Link_Timer(tmr);
+}
+
+
+/***********************************************************************
+**
+*/	void Cancel_Timer(REBREQ *req)
+/*
+**		Disarm the timer of a request, if any.
+**
+***********************************************************************/
+{
+	REBTMR *tmr = req->timer;
+
+	if (!tmr) return;
+	Unlink_Timer(tmr);
+	Free_Mem(tmr, sizeof(REBTMR));
+	req->timer = 0;
+}
+
+
+/***********************************************************************
+**
+*/	REBI64 Timer_Left(REBREQ *req)
+/*
+**		Microseconds until the timer of a request expires,
+**		or -1 if it is not armed.
+**
+***********************************************************************/
+{
+	REBTMR *tmr = req->timer;
+	REBI64 left;
+
+	if (!tmr) return -1;
+	left = tmr->due - Timer_Now();
+	return MAX(left, 0);
+}
+
+
+/***********************************************************************
+**
+*/	REBI64 Timer_Usecs(REBVAL *val)
+/*
+**		Convert a timeout value (seconds as integer or decimal, or
+**		a time) to microseconds. Returns -1 for other values.
+**
+***********************************************************************/
+{
+	REBI64 usecs;
+
+	// Range checked before scaling (also catches a NaN):
+	switch (VAL_TYPE(val)) {
+	case REB_INTEGER:
+		if (VAL_INT64(val) < 0 || VAL_INT64(val) > MAX_I64 / 1000000) Trap_Range(val);
+		usecs = VAL_INT64(val) * 1000000;
+		break;
+	case REB_DECIMAL:
+		if (!(VAL_DECIMAL(val) > -1.0 && VAL_DECIMAL(val) <= (REBDEC)(MAX_I64 / 1000000)))
+			Trap_Range(val);
+		usecs = (REBI64)(VAL_DECIMAL(val) * 1000000);
+		break;
+	case REB_TIME:
+		usecs = VAL_TIME(val) / 1000;
+		break;
+	default:
+		return -1;
+	}
+	if (usecs < 0) Trap_Range(val);
+	return usecs;
+}
+
+
+/***********************************************************************
+**
+*/	void Set_Port_Timeout(REBREQ *req, REBVAL *val)
+/*
+**		Arm (or re-arm) the timeout of a pending I/O request from
+**		the spec/timeout of its port. Expiry aborts the request.
+**
+***********************************************************************/
+{
+	REBI64 usecs;
+
+	if (!val || (usecs = Timer_Usecs(val)) < 0) return;
+	if (GET_FLAG(req->flags, RRF_PENDING)) Set_Timer(req, usecs, TMR_TIMEOUT);
+}
+
+
+/***********************************************************************
+**
+*/	void Signal_Read(REBREQ *req)
+/*
+**		Signal the read event of a request that finished at once.
+**		If the event queue is full, the timer wheel signals it
+**		when the queue takes events again.
+**
+***********************************************************************/
+{
+	REBVAL *event;
+	REBEVT evt;
+
+	if (!(event = Append_Event())) {
+		Set_Timer(req, 0, TMR_READ);
+		return;
+	}
+
+	CLEARS(&evt);
+	evt.type = EVT_READ;
+	evt.model = EVM_DEVICE;
+	evt.req = req;
+	VAL_SET(event, REB_EVENT);
+	event->data.event = evt;
+}
+
+
+/***********************************************************************
+**
+*/	static void Fire_Timer(REBTMR *tmr)
+/*
+**		Signal an expired timer. The timer is already unlinked.
+**		If the event queue is full, the timer is kept in the
+**		current slot, to fire again on the next advance.
+**
+***********************************************************************/
+{
+	REBREQ *req = tmr->req;
+	REBCNT type = tmr->type;
+	REBVAL *event = 0;
+	REBEVT evt;
+
+	// Timed out I/O, unless it finished in the meantime:
+	if (type != TMR_TIMEOUT || GET_FLAG(req->flags, RRF_PENDING)) {
+		if (!(event = Append_Event())) {
+			Link_Timer(tmr);
+			return;
+		}
+	}
+
+	req->timer = 0;
+	Free_Mem(tmr, sizeof(REBTMR));
+	if (!event) return;
+
+	// Build the whole event, as the queue slot may hold an old one:
+	CLEARS(&evt);
+
+	if (type == TMR_PORT) {
+		CLR_FLAG(req->flags, RRF_PENDING);
+		evt.type = EVT_TIME;
+		evt.model = EVM_PORT;
+		evt.ser = req->port;
+	}
+	else if (type == TMR_READ) {
+		evt.type = EVT_READ;
+		evt.model = EVM_DEVICE;
+		evt.req = req;
+	}
+	else {
+		OS_ABORT_DEVICE(req);
+		req->error = RE_TIMEOUT;
+		evt.type = EVT_ERROR;
+		evt.model = EVM_DEVICE;
+		evt.data = RE_TIMEOUT;
+		evt.req = req;
+	}
+
+	VAL_SET(event, REB_EVENT);
+	event->data.event = evt;
+}
+
+
+/***********************************************************************
+**
+*/	REBINT Expire_Timers(void)
+/*
+**		Advance the wheel to the current time. Empty each slot it
+**		passes over, firing the due timers and relinking the others
+**		to the lower levels. Returns the number of timers fired.
+**
+***********************************************************************/
+{
+	REBI64 now = Timer_Now();
+	REBTMR *list = 0;
+	REBTMR *tmr;
+	REBU64 mask;
+	REBI64 first;
+	REBI64 span;
+	REBCNT level;
+	REBCNT shift;
+	REBCNT n;
+	REBINT count = 0;
+
+	if (now < Wheel_Time) return 0;
+
+	// Collect the slots passed over (and the current ones):
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		if (!Wheel_Used[level]) continue;
+		shift = level * WHEEL_BITS;
+		first = Wheel_Time >> shift;
+		span = (now >> shift) - first;
+		if (span >= WHEEL_MASK) mask = ~(REBU64)0;
+		else {
+			mask = ((REBU64)2 << span) - 1;
+			n = (REBCNT)(first & WHEEL_MASK);
+			if (n) mask = (mask << n) | (mask >> (WHEEL_SLOTS - n));
+		}
+		mask &= Wheel_Used[level];
+		for (n = 0; mask; n++, mask >>= 1) {
+			if (!(mask & 1)) continue;
+			tmr = Wheel[level * WHEEL_SLOTS + n];
+			Wheel[level * WHEEL_SLOTS + n] = 0;
+			Wheel_Used[level] &= ~((REBU64)1 << n);
+			while (tmr) {
+				REBTMR *next = tmr->next;
+				tmr->next = list;
+				list = tmr;
+				tmr = next;
+			}
+		}
+	}
+
+	Wheel_Time = now;
+
+	while ((tmr = list)) {
+		list = tmr->next;
+		tmr->next = tmr->prev = 0;
+		if (tmr->due <= now) {
+			Fire_Timer(tmr);
+			count++;
+		}
+		else Link_Timer(tmr);
+	}
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	REBI64 Next_Timer(void)
+/*
+**		Microseconds the wheel can wait before it must advance:
+**		until the next timer is due, or a higher level slot needs
+**		to cascade. Returns -1 if no timer is armed.
+**
+***********************************************************************/
+{
+	REBI64 next = -1;
+	REBI64 tick;
+	REBI64 time;
+	REBCNT level;
+	REBCNT shift;
+	REBCNT n;
+
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		if (!Wheel_Used[level]) continue;
+		shift = level * WHEEL_BITS;
+		tick = Wheel_Time >> shift;
+		for (n = 0; n < WHEEL_SLOTS; n++) {
+			if (Wheel_Used[level] & ((REBU64)1 << ((tick + n) & WHEEL_MASK))) break;
+		}
+		time = MAX((tick + n) << shift, Wheel_Time);
+		if (next < 0 || time < next) next = time;
+	}
+
+	if (next < 0) return -1;
+	next -= Timer_Now();
+	return MAX(next, 0);
+}
+
+
+/***********************************************************************
+**
+*/	REBREQ *Next_Timed_Request(REBREQ *req)
+/*
+**		Walk the requests with armed timers (for GC marking).
+**		Start with zero; returns zero after the last one.
+**
+***********************************************************************/
+{
+	REBCNT n = 0;
+
+	if (req) {
+		REBTMR *tmr = req->timer;
+		if (tmr->next) return tmr->next->req;
+		n = tmr->slot + 1;
+	}
+
+	for (; n < WHEEL_LEVELS * WHEEL_SLOTS; n++) {
+		if (Wheel[n]) return Wheel[n]->req;
+	}
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static int Timer_Actor(REBVAL *ds, REBSER *port, REBCNT action)
+/*
+***********************************************************************/
+{
+	REBREQ *req;
 	REBVAL *arg;
-	REBVAL save_port;
+	REBI64 usecs;
 
 	Validate_Port(port, action);
 
 	arg = D_ARG(2);
 	*D_RET = *D_ARG(1);
 
-	// Validate and fetch relevant PORT fields:
-	state = BLK_SKIP(port, STD_PORT_STATE);
-	spec  = BLK_SKIP(port, STD_PORT_SPEC);
-	if (!IS_OBJECT(spec)) Trap1(RE_INVALID_SPEC, spec);
-
-	// Get or setup internal state data:
-	if (!IS_BLOCK(state)) Set_Block(state, Make_Block(127));
+	req = Use_Port_State(port, RDI_EVENT, sizeof(*req));
 
 	switch (action) {
 
-	case A_UPDATE:
-		return R_NONE;
+	case A_OPEN:
+		SET_OPEN(req);
+		break;
 
-	// Normal block actions done on events:
-	case A_POKE:
-		if (!IS_EVENT(D_ARG(3))) Trap_Arg(D_ARG(3));
-		goto act_blk;
-	case A_INSERT:
-	case A_APPEND:
-	//case A_PATH:		// not allowed: port/foo is port object field access
-	//case A_PATH_SET:	// not allowed: above
-		if (!IS_EVENT(arg)) Trap_Arg(arg);
-	case A_PICK:
-act_blk:
-		save_port = *D_ARG(1); // save for return
-		*D_ARG(1) = *state;
-		result = T_Block(ds, action);
-		SET_FLAG(Eval_Signals, SIG_EVENT_PORT);
-		if (action == A_INSERT || action == A_APPEND || action == A_REMOVE) {
-			*D_RET = save_port;
-			break;
-		}
-		return result; // return condition
+	case A_OPENQ:
+		if (IS_OPEN(req)) return R_TRUE;
+		return R_FALSE;
 
-	case A_CLEAR:
-		VAL_TAIL(state) = 0;
-		VAL_BLK_TERM(state);
-		CLR_FLAG(Eval_Signals, SIG_EVENT_PORT);
+	case A_WRITE:
+		// Set the timer (a one-shot, the awake may set it again):
+		if (!IS_BLOCK(arg)) Trap_Arg(arg);
+		arg = VAL_BLK_DATA(arg);
+		if (IS_END(arg) || IS_NONE(arg)) goto cancel;
+		if ((usecs = Timer_Usecs(arg)) < 0) Trap_Arg(arg);
+		Set_Timer(req, usecs, TMR_PORT);
+		SET_FLAG(req->flags, RRF_PENDING); // for WAIT
 		break;
 
-	case A_LENGTHQ:
-		SET_INTEGER(D_RET, VAL_TAIL(state));
+	case A_READ:
+		// Time left, or none when not set:
+		if ((usecs = Timer_Left(req)) < 0) return R_NONE;
+		VAL_SET(D_RET, REB_TIME);
+		VAL_TIME(D_RET) = usecs * 1000;
 		break;
 
-	case A_OPEN:
-		if (!req) { //!!!
-			req = OS_MAKE_DEVREQ(RDI_EVENT);
-			SET_OPEN(req);
-			OS_DO_DEVICE(req, RDC_CONNECT);		// stays queued
-		}
+	case A_UPDATE:
+		return R_NONE;
+
+	case A_CLOSE:
+		SET_CLOSED(req);
+		// fall thru...
+	case A_CLEAR:
+cancel:
+		Cancel_Timer(req);
+		CLR_FLAG(req->flags, RRF_PENDING);
 		break;
 
 	default:
@@ -124,5 +525,25 @@ act_blk:
 /*
 ***********************************************************************/
 {
-	Register_Scheme(SYM_TIMER, 0, Event_Actor);
+	CLEAR(Wheel, sizeof(Wheel));
+	CLEAR(Wheel_Used, sizeof(Wheel_Used));
+	Wheel_Time = 0;
+	Wheel_Base = OS_DELTA_TIME(0, 0);
+
+	Register_Scheme(SYM_TIMER, 0, Timer_Actor);
+}
+
+
+/***********************************************************************
+**
+*/	void Dispose_Timer_Scheme(void)
+/*
+**		Free the timers still armed. Their requests are in ports
+**		about to be freed.
+**
+***********************************************************************/
+{
+	REBREQ *req;
+
+	while ((req = Next_Timed_Request(0))) Cancel_Timer(req);
 }
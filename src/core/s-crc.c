@@ -39,7 +39,7 @@
 #define PRZCRC   0x864cfb	/* PRZ's 24-bit CRC generator polynomial */
 #define CRCINIT  0xB704CE	/* Init value for CRC accumulator */
 
-static REBCNT *CRC_Table;
+static INSTANCE REBCNT *CRC_Table;
 
 /***********************************************************************
 **
@@ -358,7 +358,7 @@ static REBCNT *CRC_Table;
 
 
 
-static u32 *crc32_table = 0;
+static INSTANCE u32 *crc32_table = 0;
 
 static void Make_CRC32_Table(void) {
 	u32 c;
@@ -400,6 +400,19 @@ REBCNT Update_CRC32(u32 crc, REBYTE *buf, int len) {
 }
 
 
+/***********************************************************************
+**
+*/	void Dispose_CRC(void)
+/*
+***********************************************************************/
+{
+	Free_Mem(CRC_Table, sizeof(REBCNT) * 256);
+	if (crc32_table) Free_Mem(crc32_table, 256 * sizeof(u32));
+	CRC_Table = 0;
+	crc32_table = 0;
+}
+
+
 
 #ifdef ndef
 Header File
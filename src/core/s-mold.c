@@ -50,11 +50,11 @@ enum REB_Punct {
 	PUNCT_MAX
 };
 
-REBYTE *Char_Escapes;
+INSTANCE REBYTE *Char_Escapes;
 #define MAX_ESC_CHAR (0x60-1) // size of escape table
 #define IS_CHR_ESC(c) ((c) <= MAX_ESC_CHAR && Char_Escapes[c])
 
-REBYTE *URL_Escapes;
+INSTANCE REBYTE *URL_Escapes;
 #define MAX_URL_CHAR (0x80-1)
 #define IS_URL_ESC(c)  ((c) <= MAX_URL_CHAR && (URL_Escapes[c] & ESC_URL))
 #define IS_FILE_ESC(c) ((c) <= MAX_URL_CHAR && (URL_Escapes[c] & ESC_FILE))
@@ -1169,6 +1169,10 @@ STOID Mold_Error(REBVAL *value, REB_MOLD *mold, REBFLG molded)
 		Mold_Vector(value, mold, molded);
 		break;
 
+	case REB_TABLE:
+		Mold_Table(value, mold, molded);
+		break;
+
 	case REB_DATATYPE:
 		if (!molded)
 			Emit(mold, "N", VAL_DATATYPE(value) + 1);
@@ -1339,11 +1343,14 @@ append:
 
 /***********************************************************************
 **
-*/	REBSER *Form_Reduce(REBSER *block, REBCNT index)
+*/	REBSER *Form_Reduce(REBSER *block, REBCNT index, REBVAL *into)
 /*
 **		Reduce a block and then form each value into a string. Return the
 **		string or NULL if an unwind triggered while reducing.
 **
+**		With INTO, the string is inserted at the INTO position (see
+**		Insert_Mold) and its series is returned.
+**
 ***********************************************************************/
 {
 	REBINT start = DSP + 1;
@@ -1366,10 +1373,36 @@ append:
 
 	DSP = start;
 
+	if (into) {
+		Insert_Mold(&mo, into);
+		return VAL_SERIES(into);
+	}
+
 	return Copy_String(mo.series, 0, -1);
 }
 
 
+/***********************************************************************
+**
+*/	void Insert_Mold(REB_MOLD *mold, REBVAL *into)
+/*
+**		Insert the molded string at the INTO string position and move
+**		the INTO index past it. Used by the /into refinements to write
+**		straight from the mold buffer without an intermediate copy.
+**
+***********************************************************************/
+{
+	REBSER *ser = VAL_SERIES(into);
+	REBCNT len = SERIES_TAIL(mold->series);
+
+	TRAP_PROTECT(ser);
+	if (VAL_INDEX(into) > SERIES_TAIL(ser)) VAL_INDEX(into) = SERIES_TAIL(ser);
+	Insert_String(ser, VAL_INDEX(into), mold->series, 0, len, FALSE);
+	TERM_SERIES(ser);
+	VAL_INDEX(into) += len;
+}
+
+
 /***********************************************************************
 **
 */  REBSER *Form_Tight_Block(REBVAL *blk)
@@ -1468,3 +1501,15 @@ append:
 	dc = ";%\"()[]{}<>";
 	for (c = LEN_BYTES(dc); c > 0; c--) URL_Escapes[*dc++] = ESC_URL | ESC_FILE;
 }
+
+
+/***********************************************************************
+**
+*/	void Dispose_Mold(void)
+/*
+***********************************************************************/
+{
+	Free_Mem(Char_Escapes, MAX_ESC_CHAR+1);
+	Free_Mem(URL_Escapes, MAX_URL_CHAR+1);
+	Char_Escapes = URL_Escapes = 0;
+}
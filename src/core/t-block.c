@@ -303,6 +303,7 @@ static void No_Nones(REBVAL *arg) {
 	}
 
 	if (IS_BINARY(arg)) {
+		Unview_Binary(arg);
 		ser = Scan_Source(VAL_BIN_DATA(arg), VAL_LEN(arg));
 		goto done;
 	}
@@ -204,7 +204,7 @@
 
 /***********************************************************************
 **
-*/	static REBFLG Get_Event_Var(REBVAL *value, REBCNT sym, REBVAL *val)
+*/	REBFLG Get_Event_Var(REBVAL *value, REBCNT sym, REBVAL *val)
 /*
 ***********************************************************************/
 {
@@ -128,6 +128,7 @@ of_type:
 			case REB_FUNCTION:
 			case REB_CLOSURE:
 				Set_Block(value, Clone_Block(VAL_FUNC_BODY(value)));
+				if (type == REB_CLOSURE) Unshare_Block(VAL_SERIES(value), 0, 0);
 				Unbind_Block(VAL_BLK(value), TRUE);
 				break;
 			case REB_NATIVE:
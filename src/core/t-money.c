@@ -106,6 +106,64 @@
 }
 
 
+/***********************************************************************
+**
+*/	static deci Money_Elem(REBVAL *val)
+/*
+**		Money value of a block element, converted the same way as
+**		the second argument of money! math.
+**
+***********************************************************************/
+{
+	if (IS_MONEY(val)) return VAL_DECI(val);
+	if (IS_INTEGER(val)) return int_to_deci(VAL_INT64(val));
+	if (IS_DECIMAL(val) || IS_PERCENT(val)) return decimal_to_deci(VAL_DECIMAL(val));
+	Trap_Arg(val);
+	return VAL_DECI(val); // not reached
+}
+
+
+/***********************************************************************
+**
+*/	void Sum_Money_Block(REBVAL *blk, REBVAL *out)
+/*
+**		Sum of a block of money! values (integers and decimals are
+**		allowed too). Amounts of the same scale add without any
+**		rounding work, so this is the fast way to total a ledger.
+**
+***********************************************************************/
+{
+	REBVAL *val = VAL_BLK_DATA(blk);
+	deci sum = int_to_deci(0);
+
+	for (; NOT_END(val); val++) sum = deci_add(sum, Money_Elem(val));
+
+	SET_MONEY(out, sum);
+}
+
+
+/***********************************************************************
+**
+*/	void Dot_Money_Block(REBVAL *blk1, REBVAL *blk2, REBVAL *out)
+/*
+**		Sum of the products of two blocks of the same length, as
+**		money! (e.g. prices times quantities).
+**
+***********************************************************************/
+{
+	REBVAL *v1 = VAL_BLK_DATA(blk1);
+	REBVAL *v2 = VAL_BLK_DATA(blk2);
+	deci sum = int_to_deci(0);
+
+	if (VAL_LEN(blk1) != VAL_LEN(blk2)) Trap_Arg(blk2);
+
+	for (; NOT_END(v1); v1++, v2++)
+		sum = deci_add(sum, deci_multiply(Money_Elem(v1), Money_Elem(v2)));
+
+	SET_MONEY(out, sum);
+}
+
+
 /***********************************************************************
 **
 */	REBTYPE(Money)
@@ -241,13 +241,18 @@ static REBSER *Trim_Object(REBSER *obj)
 ***********************************************************************/
 {
 	REBINT n = 0;
+	REBSER *frame = VAL_OBJ_FRAME(pvs->value);
 
-	if (!VAL_OBJ_FRAME(pvs->value)) {
+	if (!frame) {
 		return PE_NONE; // Error objects may not have a frame.
 	}
 
 	if (IS_WORD(pvs->select)) {
-		n = Find_Word_Index(VAL_OBJ_FRAME(pvs->value), VAL_WORD_SYM(pvs->select), FALSE);
+#ifdef HAS_SHAPE_CACHE
+		n = Find_Word_Slot(frame, pvs->select);
+#else
+		n = Find_Word_Index(frame, VAL_WORD_SYM(pvs->select), FALSE);
+#endif
 	}
 //	else if (IS_INTEGER(pvs->select)) {
 //		n = Int32s(pvs->select, 1);
@@ -260,6 +265,8 @@ static REBSER *Trim_Object(REBSER *obj)
 	if (pvs->setval && IS_END(pvs->path+1) && VAL_PROTECTED(VAL_FRM_WORD(pvs->value, n)))
 		Trap1(RE_LOCKED_WORD, pvs->select);
 
+	if (VAL_GET_OPT(VAL_OBJ_VALUES(pvs->value) + n, OPTS_PROTO))
+		Unshare_Frame_Value(VAL_OBJ_FRAME(pvs->value), n);
 	pvs->value = VAL_OBJ_VALUES(pvs->value) + n;
 	return PE_SET;
 	// if setval, check PROTECT mode!!!
@@ -282,6 +289,9 @@ static REBSER *Trim_Object(REBSER *obj)
 	REBSER *obj, *src_obj;
 	REBCNT type = 0;
 
+	// Values shared with a prototype are copied before use:
+	if (action != A_MAKE && IS_OBJECT(value)) Unshare_Frame(VAL_OBJ_FRAME(value));
+
 	switch (action) {
 
 	case A_MAKE:
@@ -361,7 +371,7 @@ static REBSER *Trim_Object(REBSER *obj)
 
 			// make parent none | []
 			if (IS_NONE(arg) || (IS_BLOCK(arg) && IS_EMPTY(arg))) {
-				obj = Copy_Block_Values(src_obj, 0, SERIES_TAIL(src_obj), TS_CLONE);
+				obj = Make_Object(src_obj, 0);
 				Rebind_Frame(src_obj, obj);
 				break;	// returns obj
 			}
@@ -450,6 +460,7 @@ static REBSER *Trim_Object(REBSER *obj)
 			else types |= VAL_TYPESET(arg);
 		}
 		VAL_OBJ_FRAME(value) = obj = Copy_Block(VAL_OBJ_FRAME(value), 0);
+		FRM_PARENT(obj) = 0;
 		if (types != 0) Copy_Deep_Values(obj, 1, SERIES_TAIL(obj), types);
 		break; // returns value
 	}
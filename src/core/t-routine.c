@@ -34,13 +34,13 @@
 #include <ffi.h>
 
 #define QUEUE_EXTRA_MEM(v, p) do {\
-	*(void**) SERIES_SKIP(v->extra_mem, SERIES_TAIL(v->extra_mem)) = p;\
 	EXPAND_SERIES_TAIL(v->extra_mem, 1);\
+	*(void**) SERIES_SKIP(v->extra_mem, SERIES_TAIL(v->extra_mem) - 1) = p;\
 } while (0)
 
 extern	REBOL_HOST_LIB *Host_Lib;
 
-static ffi_type * struct_type_to_ffi [STRUCT_TYPE_MAX];
+static INSTANCE ffi_type * struct_type_to_ffi [STRUCT_TYPE_MAX];
 
 static void process_type_block(REBVAL *out, REBVAL *blk, REBCNT n, REBOOL make);
 
@@ -225,6 +225,7 @@ static REBOOL rebol_type_to_ffi(REBVAL *out, REBVAL *elem, REBCNT idx, REBOOL ma
 					TYPE_SET(&rebol_args[idx], REB_STRING);
 					TYPE_SET(&rebol_args[idx], REB_BINARY);
 					TYPE_SET(&rebol_args[idx], REB_VECTOR);
+					TYPE_SET(&rebol_args[idx], REB_STRUCT);
 				}
 				break;
 			default:
@@ -259,11 +260,10 @@ static REBOOL rebol_type_to_ffi(REBVAL *out, REBVAL *elem, REBCNT idx, REBOOL ma
  * function args start from idx = 1
  *
  * For FFI_TYPE_POINTER, a temperary pointer could be needed 
- * (whose address is returned). The pointer is stored in rebol 
- * stack, so DS_POP is needed after the function call is done.
- * The number to pop is returned by pop
+ * (whose address is returned). The pointer is stored in tmp,
+ * a slot of the argument arena.
  * */
-static void *arg_to_ffi(REBVAL *rot, REBVAL *arg, REBCNT idx, REBINT *pop)
+static void *arg_to_ffi(REBVAL *rot, REBVAL *arg, REBCNT idx, REBI64 *tmp)
 {
 	ffi_type **args = (ffi_type**)SERIES_DATA(VAL_ROUTINE_FFI_ARG_TYPES(rot));
 	REBSER *rebol_args = NULL;
@@ -348,10 +348,12 @@ static void *arg_to_ffi(REBVAL *rot, REBVAL *arg, REBCNT idx, REBINT *pop)
 				case REB_BINARY:
 				case REB_VECTOR:
 					{
-						DS_PUSH_INTEGER((REBUPT)VAL_DATA(arg));
-						(*pop) ++;
-						return &VAL_INT64(DS_TOP);
+						*tmp = (REBUPT)VAL_DATA(arg);
+						return tmp;
 					}
+				case REB_STRUCT: // by reference, not copied
+					*tmp = (REBUPT)SERIES_SKIP(VAL_STRUCT_DATA_BIN(arg), VAL_STRUCT_OFFSET(arg));
+					return tmp;
 				default:
 					Trap3(RE_EXPECT_ARG, DSF_WORD(DSF), BLK_SKIP(rebol_args, idx), arg);
 			}
@@ -480,15 +482,146 @@ static void ffi_to_rebol(REBRIN *rin,
 
 /***********************************************************************
 **
-*/	void Call_Routine(REBVAL *rot, REBSER *args, REBVAL *ret)
+*/	static REBUPT int_to_c(REBVAL *rot, REBVAL *arg, REBCNT idx)
 /*
+**		Convert an argument of a ROUTINE_FAST_INT routine. These
+**		only take integers as wide as a pointer.
+**
+***********************************************************************/
+{
+	if (!IS_INTEGER(arg))
+		Trap3(RE_EXPECT_ARG, DSF_WORD(DSF), BLK_SKIP(VAL_ROUTINE_ARGS(rot), idx), arg);
+	return (REBUPT)VAL_INT64(arg);
+}
+
+
+/***********************************************************************
+**
+*/	static void Call_Fast(REBVAL *rot, REBVAL *args, REBVAL *ret)
+/*
+**		Call a routine with a simple signature directly, without
+**		libffi. See Set_Fast_Call for the signatures.
+**
+***********************************************************************/
+{
+	ffi_type **types = (ffi_type**)SERIES_DATA(VAL_ROUTINE_FFI_ARG_TYPES(rot));
+	void (*fp)(void) = VAL_ROUTINE_FUNCPTR(rot);
+	REBCNT n = SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot)) - 1;
+
+	if (ROUTINE_GET_FLAG(VAL_ROUTINE_INFO(rot), ROUTINE_FAST_DEC)) {
+		double d[4];
+		double r = 0;
+		REBCNT i;
+		for (i = 0; i < n; i++) {
+			if (!IS_DECIMAL(&args[i]))
+				Trap3(RE_EXPECT_ARG, DSF_WORD(DSF), BLK_SKIP(VAL_ROUTINE_ARGS(rot), i + 1), &args[i]);
+			d[i] = VAL_DECIMAL(&args[i]);
+		}
+		switch (n) {
+			case 1: r = ((double (*)(double))fp)(d[0]); break;
+			case 2: r = ((double (*)(double, double))fp)(d[0], d[1]); break;
+			case 3: r = ((double (*)(double, double, double))fp)(d[0], d[1], d[2]); break;
+			case 4: r = ((double (*)(double, double, double, double))fp)(d[0], d[1], d[2], d[3]); break;
+		}
+		SET_DECIMAL(ret, r);
+	}
+	else {
+		REBUPT a[4];
+		REBUPT r = 0;
+		REBCNT i;
+		for (i = 0; i < n; i++) a[i] = int_to_c(rot, &args[i], i + 1);
+		if (types[0]->type == FFI_TYPE_VOID) {
+			switch (n) {
+				case 0: ((void (*)(void))fp)(); break;
+				case 1: ((void (*)(REBUPT))fp)(a[0]); break;
+				case 2: ((void (*)(REBUPT, REBUPT))fp)(a[0], a[1]); break;
+				case 3: ((void (*)(REBUPT, REBUPT, REBUPT))fp)(a[0], a[1], a[2]); break;
+				case 4: ((void (*)(REBUPT, REBUPT, REBUPT, REBUPT))fp)(a[0], a[1], a[2], a[3]); break;
+			}
+			SET_UNSET(ret);
+			return;
+		}
+		switch (n) {
+			case 0: r = ((REBUPT (*)(void))fp)(); break;
+			case 1: r = ((REBUPT (*)(REBUPT))fp)(a[0]); break;
+			case 2: r = ((REBUPT (*)(REBUPT, REBUPT))fp)(a[0], a[1]); break;
+			case 3: r = ((REBUPT (*)(REBUPT, REBUPT, REBUPT))fp)(a[0], a[1], a[2]); break;
+			case 4: r = ((REBUPT (*)(REBUPT, REBUPT, REBUPT, REBUPT))fp)(a[0], a[1], a[2], a[3]); break;
+		}
+		if (types[0]->type == FFI_TYPE_SINT64 || types[0]->type == FFI_TYPE_SINT32)
+			SET_INTEGER(ret, (REBIPT)r);
+		else
+			SET_INTEGER(ret, r);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Set_Fast_Call(REBRIN *rin)
+/*
+**		Flag a routine that can be called without libffi: the default
+**		ABI, up to four arguments, and either all integers as wide as
+**		a pointer or all doubles. Only then is the C function called
+**		through its own type; narrower integers and pointers may be
+**		passed differently by the ABI, so they go through libffi.
+**
+***********************************************************************/
+{
+	ffi_type **types = (ffi_type**)SERIES_DATA(rin->arg_types);
+	REBCNT n = SERIES_TAIL(rin->arg_types);
+	REBFLG ints = TRUE;
+	REBFLG decs = TRUE;
+	REBCNT i;
+
+	if (rin->abi != FFI_DEFAULT_ABI || n > 5 || IS_CALLBACK_ROUTINE(rin)) return;
+
+	for (i = 0; i < n; i++) {
+		switch (types[i]->type) {
+			case FFI_TYPE_VOID:
+				if (i > 0) ints = FALSE; // return only
+				decs = FALSE;
+				break;
+			case FFI_TYPE_UINT32:
+			case FFI_TYPE_SINT32:
+				if (sizeof(REBUPT) != 4) ints = FALSE;
+				decs = FALSE;
+				break;
+			case FFI_TYPE_UINT64:
+			case FFI_TYPE_SINT64:
+				if (sizeof(REBUPT) != 8) ints = FALSE;
+				decs = FALSE;
+				break;
+			case FFI_TYPE_DOUBLE:
+				ints = FALSE;
+				break;
+			default:
+				ints = decs = FALSE;
+		}
+	}
+
+	if (ints) ROUTINE_SET_FLAG(rin, ROUTINE_FAST_INT);
+	else if (decs && n > 1) ROUTINE_SET_FLAG(rin, ROUTINE_FAST_DEC);
+}
+
+
+/***********************************************************************
+**
+*/	void Call_Routine(REBVAL *rot, REBVAL *args, REBVAL *ret)
+/*
+**		Args points to the first argument. The argument pointers
+**		passed to libffi live in the routine's arena (made once by
+**		MT_Routine), so a call allocates nothing. A callback that
+**		calls the same routine again can reuse the arena, because
+**		ffi_call is done with it once the C function is entered.
+**
 ***********************************************************************/
 {
 	REBCNT i = 0;
 	void *rvalue = NULL;
 	REBSER *ser = NULL;
 	void ** ffi_args = NULL;
-	REBINT pop = 1; /* for tmp */
+	REBI64 *tmps = NULL; /* for pointer arguments */
 	REBVAL *tmp = NULL;
 	REBVAL *varargs = NULL;
 	REBINT n_fixed = 0; /* nunmber of fixed arguments */
@@ -499,10 +632,16 @@ static void ffi_to_rebol(REBRIN *rin,
 		Trap0(RE_BAD_LIBRARY);
 	}
 
+	if (ROUTINE_GET_FLAG(VAL_ROUTINE_INFO(rot), ROUTINE_FAST_INT | ROUTINE_FAST_DEC)) {
+		Call_Fast(rot, args, ret);
+		return;
+	}
+
 	asp = RL_Get_Aux_Pointer();
 
 	if (ROUTINE_GET_FLAG(VAL_ROUTINE_INFO(rot), ROUTINE_VARARGS)) {
-		varargs = BLK_HEAD(args);
+		REBCNT n;
+		varargs = args;
 		if (!IS_BLOCK(varargs)) {
 			Trap_Arg(varargs);
 		}
@@ -510,18 +649,20 @@ static void ffi_to_rebol(REBRIN *rin,
 		if ((VAL_LEN(varargs) - n_fixed) % 2) {
 			Trap_Arg(varargs);
 		}
-		ser = Make_Series(n_fixed + (VAL_LEN(varargs) - n_fixed) / 2, sizeof(void *), FALSE);
-	} else if ((SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot))) > 1) {
-		ser = Make_Series(SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot)) - 1, sizeof(void *), FALSE);
-	}
+		n = n_fixed + (VAL_LEN(varargs) - n_fixed) / 2;
+		/* temporaries, then pointers (as in the arena) */
+		ser = Make_Series(n + 1, sizeof(REBI64) + sizeof(void *), FALSE);
 
-	/* save ser on stack such that it won't be GC'ed */
-	if (ser != NULL) {
+		/* save ser on stack such that it won't be GC'ed */
 		DS_PUSH_NONE;
 		tmp = DS_TOP;
 		SET_TYPE(tmp, REB_BLOCK);
 		VAL_SERIES(tmp) = ser;
-		ffi_args = (void **) SERIES_DATA(ser);
+		tmps = (REBI64 *) SERIES_DATA(ser);
+		ffi_args = (void **) (tmps + n);
+	} else {
+		tmps = (REBI64 *) VAL_ROUTINE_ARENA(rot);
+		ffi_args = (void **) (tmps + SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot)));
 	}
 
 	if (ROUTINE_GET_FLAG(VAL_ROUTINE_INFO(rot), ROUTINE_VARARGS)) {
@@ -550,12 +691,13 @@ static void ffi_to_rebol(REBRIN *rin,
 					Trap_Arg(reb_type);
 				}
 				v = Append_Value(VAL_ROUTINE_ALL_ARGS(rot));
-				Init_Word(v, SYM_ELLIPSIS); //FIXME, be clear
+				Init_Frame_Word(v, SYM_ELLIPSIS); //FIXME, be clear
+				VAL_BIND_TYPESET(v) = 0; // the arg's types are set below
 				EXPAND_SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot), 1);
 				process_type_block(rot, reb_type, j, FALSE);
 				i ++;
 			}
-			ffi_args[j - 1] = arg_to_ffi(rot, reb_arg, j, &pop);
+			ffi_args[j - 1] = arg_to_ffi(rot, reb_arg, j, &tmps[j - 1]);
 		}
 		if (VAL_ROUTINE_CIF(rot) == NULL) {
 			VAL_ROUTINE_CIF(rot) = OS_MAKE(sizeof(ffi_cif));
@@ -578,20 +720,85 @@ static void ffi_to_rebol(REBRIN *rin,
 		}
 	} else {
 		for (i = 1; i < SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot)); i ++) {
-			ffi_args[i - 1] = arg_to_ffi(rot, BLK_SKIP(args, i - 1), i, &pop);
+			ffi_args[i - 1] = arg_to_ffi(rot, &args[i - 1], i, &tmps[i - 1]);
 		}
 	}
 	prep_rvalue(VAL_ROUTINE_INFO(rot), ret);
-	rvalue = arg_to_ffi(rot, ret, 0, &pop);
+	rvalue = arg_to_ffi(rot, ret, 0, NULL);
 	ffi_call(VAL_ROUTINE_CIF(rot),
 			 (void (*) (void))VAL_ROUTINE_FUNCPTR(rot),
 			 rvalue,
 			 ffi_args);
 	ffi_to_rebol(VAL_ROUTINE_INFO(rot), ((ffi_type**)SERIES_DATA(VAL_ROUTINE_FFI_ARG_TYPES(rot)))[0], rvalue, ret);
-	DSP -= pop;
+	if (ser != NULL) DS_POP;
 	RL_Restore_And_Free_Aux_Pointer(asp);
 }
 
+
+/***********************************************************************
+**
+*/	void Call_Routine_Each(REBVAL *rot, REBVAL *data, REBVAL *out)
+/*
+**		Call a routine once for each group of arguments in a block
+**		or vector. The results are a vector for a vector (int64 or
+**		decimal 64, by the return type), else a block. For a routine
+**		that returns nothing, the result is the number of calls.
+**
+***********************************************************************/
+{
+	ffi_type **types = (ffi_type**)SERIES_DATA(VAL_ROUTINE_FFI_ARG_TYPES(rot));
+	REBCNT argc = SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(rot)) - 1;
+	REBCNT len = VAL_LEN(data);
+	REBCNT calls;
+	REBSER *args;
+	REBSER *res = 0;
+	REBVAL result;
+	REBCNT rtype = types[0]->type;
+	REBCNT i, n;
+
+	if (ROUTINE_GET_FLAG(VAL_ROUTINE_INFO(rot), ROUTINE_VARARGS)) Trap_Arg(rot);
+	if (argc == 0 || len % argc) Trap_Arg(data);
+	calls = len / argc;
+
+	// Arguments of a call (reused), kept GC safe on the stack:
+	args = Make_Block(argc);
+	SERIES_TAIL(args) = argc;
+	SET_END(BLK_SKIP(args, argc));
+	DS_PUSH_NONE;
+	Set_Block(DS_TOP, args);
+
+	if (rtype == FFI_TYPE_VOID) {
+		SET_INTEGER(out, calls);
+	}
+	else if (IS_VECTOR(data) && rtype != FFI_TYPE_STRUCT) {
+		REBINT dec = (rtype == FFI_TYPE_FLOAT || rtype == FFI_TYPE_DOUBLE);
+		res = Make_Vector(dec, 0, 0, 64, calls);
+		Set_Series(REB_VECTOR, out, res);
+	}
+	else {
+		res = Make_Block(calls);
+		Set_Block(out, res);
+	}
+
+	for (n = 0; n < calls; n++) {
+		for (i = 0; i < argc; i++) {
+			if (IS_VECTOR(data))
+				Set_Vector_Value(BLK_SKIP(args, i), VAL_SERIES(data), VAL_INDEX(data) + n * argc + i);
+			else
+				*BLK_SKIP(args, i) = *VAL_BLK_SKIP(data, n * argc + i);
+		}
+		SET_NONE(&result);
+		Call_Routine(rot, BLK_HEAD(args), &result);
+		if (rtype == FFI_TYPE_VOID) continue;
+		if (!IS_VECTOR(out)) Append_Val(res, &result);
+		else if (IS_DECIMAL(&result)) ((REBDEC*)res->data)[n] = VAL_DECIMAL(&result);
+		else ((REBI64*)res->data)[n] = VAL_INT64(&result);
+	}
+
+	DS_POP;
+}
+
+
 /***********************************************************************
 **
 */	void Free_Routine(REBRIN *rin)
@@ -894,7 +1101,8 @@ static void callback_dispatcher(ffi_cif *cif, void *ret, void **args, void *user
 						VAL_ROUTINE_FIXED_ARGS(out) = Copy_Series(VAL_ROUTINE_ARGS(out));
 						Remove_Series(VAL_ROUTINE_ARGS(out), 1, SERIES_TAIL(VAL_ROUTINE_ARGS(out)));
 						v = Append_Value(VAL_ROUTINE_ARGS(out));
-						Init_Word(v, SYM_VARARGS);
+						Init_Frame_Word(v, SYM_VARARGS);
+						VAL_BIND_TYPESET(v) = 0;
 						TYPE_SET(v, REB_BLOCK);
 					} else {
 						REBVAL *v = NULL;
@@ -903,7 +1111,8 @@ static void callback_dispatcher(ffi_cif *cif, void *ret, void **args, void *user
 							Trap_Arg(blk);
 						}
 						v = Append_Value(VAL_ROUTINE_ARGS(out));
-						Init_Word(v, VAL_WORD_SYM(blk));
+						Init_Frame_Word(v, VAL_WORD_SYM(blk));
+						VAL_BIND_TYPESET(v) = 0; // the arg's types are set below
 						EXPAND_SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(out), 1);
 
 						++ blk;
@@ -1002,10 +1211,16 @@ static void callback_dispatcher(ffi_cif *cif, void *ret, void **args, void *user
 	}
 
 	if (!ROUTINE_GET_FLAG(VAL_ROUTINE_INFO(out), ROUTINE_VARARGS)) {
+		REBCNT argc = SERIES_TAIL(VAL_ROUTINE_FFI_ARG_TYPES(out));
 		VAL_ROUTINE_CIF(out) = OS_MAKE(sizeof(ffi_cif));
 		//printf("allocated cif at: %p\n", VAL_ROUTINE_CIF(out));
 		QUEUE_EXTRA_MEM(VAL_ROUTINE_INFO(out), VAL_ROUTINE_CIF(out));
 
+		/* argument arena: temporaries for pointer arguments, then the pointers */
+		VAL_ROUTINE_ARENA(out) = OS_MAKE(argc * (sizeof(REBI64) + sizeof(void*)));
+		QUEUE_EXTRA_MEM(VAL_ROUTINE_INFO(out), VAL_ROUTINE_ARENA(out));
+		if (type == REB_ROUTINE) Set_Fast_Call(VAL_ROUTINE_INFO(out));
+
 		/* series data could have moved */
 		args = (ffi_type**)SERIES_DATA(VAL_ROUTINE_FFI_ARG_TYPES(out));
 		if (FFI_OK != ffi_prep_cif((ffi_cif*)VAL_ROUTINE_CIF(out),
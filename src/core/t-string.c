@@ -370,6 +370,8 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 
 	if (n < 0 || (REBCNT)n >= SERIES_TAIL(ser)) return PE_BAD_RANGE;
 
+	TRAP_PROTECT(ser);
+
 	if (IS_CHAR(val)) {
 		c = VAL_CHAR(val);
 		if (c > MAX_CHAR) return PE_BAD_SET;
@@ -391,8 +393,6 @@ static REBSER *make_binary(REBVAL *arg, REBOOL make)
 	else
 		return PE_BAD_SELECT;
 
-	TRAP_PROTECT(ser);
-
 	if (BYTE_SIZE(ser) && c > 0xff) Widen_String(ser);
 	SET_ANY_CHAR(ser, n, c);
 
@@ -618,6 +618,7 @@ zero_str:
 			else {
 				VAL_TAIL(value) = (REBCNT)index;
 				TERM_SERIES(VAL_SERIES(value));
+				if (SERIES_TAIL(GC_Views)) Trim_Views(VAL_SERIES(value));
 			}
 		}
 		break;
@@ -58,6 +58,74 @@ static const REBINT type_to_sym [STRUCT_TYPE_MAX] = {
 	//STRUCT_TYPE_MAX
 };
 
+#define FIELD_CANON(f) VAL_SYM_CANON(BLK_SKIP(PG_Word_Table.series, (f)->sym))
+
+#define FIELD_CACHE_SIZE 64	// must be a power of 2
+
+static INSTANCE struct {
+	REBSER *fields;
+	REBCNT canon;
+	REBCNT index;
+} Field_Cache[FIELD_CACHE_SIZE];
+
+/***********************************************************************
+**
+*/	static struct Struct_Field *Find_Struct_Field(REBSER *fields, REBCNT canon)
+/*
+**		Find a field by the canon symbol of its name. Hits are kept in
+**		a small cache keyed by the fields series (shared by all structs
+**		made from the same spec), so repeated path access does not scan.
+**		An entry is verified before use; a stale one is just a miss.
+**
+***********************************************************************/
+{
+	struct Struct_Field *field = (struct Struct_Field *)SERIES_DATA(fields);
+	REBCNT h = ((REBCNT)((REBUPT)fields >> 4) ^ canon) & (FIELD_CACHE_SIZE - 1);
+	REBCNT i = Field_Cache[h].index;
+
+	if (Field_Cache[h].fields == fields && Field_Cache[h].canon == canon
+		&& i < SERIES_TAIL(fields) && FIELD_CANON(field + i) == canon)
+		return field + i;
+
+	for (i = 0; i < SERIES_TAIL(fields); i++) {
+		if (FIELD_CANON(field + i) == canon) {
+			Field_Cache[h].fields = fields;
+			Field_Cache[h].canon = canon;
+			Field_Cache[h].index = i;
+			return field + i;
+		}
+	}
+	return NULL;
+}
+
+/***********************************************************************
+**
+*/	static void Init_Struct_View(REBVAL *out, REBSER *spec, REBSER *fields, REBSER *bin, REBCNT offset, REBCNT len, REBCNT count)
+/*
+**		Make a struct value that uses len bytes of bin at offset as
+**		its storage. Nothing is copied: nested struct fields and the
+**		elements of a struct array are views of their parent's data.
+**
+***********************************************************************/
+{
+	REBSER *data = Make_Series(1, sizeof(struct Struct_Data), FALSE);
+	struct Struct_Data *sd;
+
+	EXPAND_SERIES_TAIL(data, 1);
+	BARE_SERIES(data);
+	sd = (struct Struct_Data *)SERIES_DATA(data);
+	sd->data = bin;
+	sd->offset = offset;
+	sd->len = len;
+	sd->flags = 0;
+	sd->count = count;
+
+	VAL_STRUCT_SPEC(out) = spec;
+	VAL_STRUCT_FIELDS(out) = fields;
+	VAL_STRUCT_DATA(out) = data;
+	SET_TYPE(out, REB_STRUCT);
+}
+
 static get_scalar(REBSTU *stu,
 				  struct Struct_Field *field,
 				  REBCNT n, /* element index, starting from 0 */
@@ -101,13 +169,9 @@ static get_scalar(REBSTU *stu,
 			break;
 		case STRUCT_TYPE_STRUCT:
 			{
-				SET_TYPE(val, REB_STRUCT);
-				VAL_STRUCT_FIELDS(val) = field->fields;
-				VAL_STRUCT_SPEC(val) = field->spec;
-				VAL_STRUCT_DATA(val) = Make_Series(1, sizeof(struct Struct_Data), FALSE);
-				VAL_STRUCT_DATA_BIN(val) = STRUCT_DATA_BIN(stu);
-				VAL_STRUCT_OFFSET(val) = data - SERIES_DATA(VAL_STRUCT_DATA_BIN(val));
-				VAL_STRUCT_LEN(val) = field->size;
+				REBSER *bin = STRUCT_DATA_BIN(stu);
+				Init_Struct_View(val, field->spec, field->fields, bin,
+					data - SERIES_DATA(bin), field->size, 0);
 			}
 			break;
 		case STRUCT_TYPE_REBVAL:
@@ -122,33 +186,36 @@ static get_scalar(REBSTU *stu,
 
 /***********************************************************************
 **
-*/	static REBFLG Get_Struct_Var(REBSTU *stu, REBVAL *word, REBVAL *val)
+*/	static void Get_Struct_Field(REBSTU *stu, struct Struct_Field *field, REBVAL *val)
 /*
 ***********************************************************************/
 {
-	struct Struct_Field *field = NULL;
-	REBCNT i = 0;
-	field = (struct Struct_Field *)SERIES_DATA(stu->fields);
-	for (i = 0; i < SERIES_TAIL(stu->fields); i ++, field ++) {
-		if (VAL_WORD_CANON(word) == VAL_SYM_CANON(BLK_SKIP(PG_Word_Table.series, field->sym))) {
-			if (field->array) {
-				REBSER *ser = Make_Block(field->dimension);
-				REBCNT n = 0;
-				SET_TYPE(val, REB_BLOCK);
-				for (n = 0; n < field->dimension; n ++) {
-					REBVAL elem;
-					get_scalar(stu, field, n, &elem);
-					Append_Val(ser, &elem);
-				}
-				VAL_SERIES(val) = ser;
-				VAL_INDEX(val) = 0;
-			} else {
-				get_scalar(stu, field, 0, val);
-			}
-			return TRUE;
+	if (field->array) {
+		REBSER *ser = Make_Block(field->dimension);
+		REBCNT n = 0;
+		for (n = 0; n < field->dimension; n ++) {
+			REBVAL elem;
+			get_scalar(stu, field, n, &elem);
+			Append_Val(ser, &elem);
 		}
+		Set_Block(val, ser);
+	} else {
+		get_scalar(stu, field, 0, val);
 	}
-	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Get_Struct_Var(REBSTU *stu, REBVAL *word, REBVAL *val)
+/*
+***********************************************************************/
+{
+	struct Struct_Field *field = Find_Struct_Field(stu->fields, VAL_WORD_CANON(word));
+
+	if (!field) return FALSE;
+	Get_Struct_Field(stu, field, val);
+	return TRUE;
 }
 
 
@@ -265,15 +332,10 @@ static REBOOL same_fields(REBSER *tgt, REBSER *src)
 	return TRUE;
 }
 
-static REBOOL assign_scalar(REBSTU *stu,
-							struct Struct_Field *field,
-							REBCNT n, /* element index, starting from 0 */
-							REBVAL *val)
+static REBOOL assign_data(struct Struct_Field *field, void *data, REBVAL *val)
 {
 	u64 i = 0;
 	double d = 0;
-	void *data = SERIES_SKIP(STRUCT_DATA_BIN(stu),
-							 STRUCT_OFFSET(stu) + field->offset + n * field->size);
 
 	if (field->type == STRUCT_TYPE_REBVAL) {
 		memcpy(data, val, sizeof(REBVAL));
@@ -356,46 +418,49 @@ static REBOOL assign_scalar(REBSTU *stu,
 	return TRUE;
 }
 
+static REBOOL assign_scalar(REBSTU *stu,
+							struct Struct_Field *field,
+							REBCNT n, /* element index, starting from 0 */
+							REBVAL *val)
+{
+	return assign_data(field, SERIES_SKIP(STRUCT_DATA_BIN(stu),
+							 STRUCT_OFFSET(stu) + field->offset + n * field->size), val);
+}
+
 /***********************************************************************
 **
 */	static REBFLG Set_Struct_Var(REBSTU *stu, REBVAL *word, REBVAL *elem, REBVAL *val)
 /*
 ***********************************************************************/
 {
-	struct Struct_Field *field = NULL;
-	REBCNT i = 0;
-	field = (struct Struct_Field *)SERIES_DATA(stu->fields);
-	for (i = 0; i < SERIES_TAIL(stu->fields); i ++, field ++) {
-		if (VAL_WORD_CANON(word) == VAL_SYM_CANON(BLK_SKIP(PG_Word_Table.series, field->sym))) {
-			if (field->array) {
-				if (elem == NULL) { //set the whole array
-					REBCNT n = 0;
-					if ((!IS_BLOCK(val) || field->dimension != VAL_LEN(val))) {
-						return FALSE;
-					}
+	struct Struct_Field *field = Find_Struct_Field(stu->fields, VAL_WORD_CANON(word));
 
-					for(n = 0; n < field->dimension; n ++) {
-						if (!assign_scalar(stu, field, n, VAL_BLK_SKIP(val, n))) {
-							return FALSE;
-						}
-					}
+	if (!field) return FALSE;
 
-				} else {// set only one element
-					if (!IS_INTEGER(elem)
-						|| VAL_INT32(elem) <= 0
-						|| VAL_INT32(elem) > field->dimension) {
-						return FALSE;
-					}
-					return assign_scalar(stu, field, VAL_INT32(elem) - 1, val);
+	if (field->array) {
+		if (elem == NULL) { //set the whole array
+			REBCNT n = 0;
+			if ((!IS_BLOCK(val) || field->dimension != VAL_LEN(val))) {
+				return FALSE;
+			}
+
+			for(n = 0; n < field->dimension; n ++) {
+				if (!assign_scalar(stu, field, n, VAL_BLK_SKIP(val, n))) {
+					return FALSE;
 				}
-				return TRUE;
-			} else {
-				return assign_scalar(stu, field, 0, val);
 			}
-			return TRUE;
+
+		} else {// set only one element
+			if (!IS_INTEGER(elem)
+				|| VAL_INT32(elem) <= 0
+				|| VAL_INT32(elem) > field->dimension) {
+				return FALSE;
+			}
+			return assign_scalar(stu, field, VAL_INT32(elem) - 1, val);
 		}
+		return TRUE;
 	}
-	return FALSE;
+	return assign_scalar(stu, field, 0, val);
 }
 
 /* parse struct attribute */
@@ -631,6 +696,9 @@ static REBOOL parse_field_type(struct Struct_Field *field, REBVAL *spec, REBVAL
 {
 	//RL_Print("%s\n", __func__);
 	REBINT max_fields = 16;
+
+	/* none of the series below is reachable until the type is set */
+	DISABLE_GC;
 	VAL_STRUCT_FIELDS(out) = Make_Series(max_fields, sizeof(struct Struct_Field), FALSE);
 	BARE_SERIES(VAL_STRUCT_FIELDS(out));
 	if (IS_BLOCK(data)) {
@@ -650,6 +718,7 @@ static REBOOL parse_field_type(struct Struct_Field *field, REBVAL *spec, REBVAL
 		VAL_STRUCT_DATA(out) = Make_Series(1, sizeof(struct Struct_Data), FALSE);
 		EXPAND_SERIES_TAIL(VAL_STRUCT_DATA(out), 1);
 		BARE_SERIES(VAL_STRUCT_DATA(out));
+		VAL_STRUCT_COUNT(out) = 0;
 
 		VAL_STRUCT_DATA_BIN(out) = Make_Series(max_fields << 2, 1, FALSE);
 		BARE_SERIES(VAL_STRUCT_DATA_BIN(out));
@@ -657,6 +726,7 @@ static REBOOL parse_field_type(struct Struct_Field *field, REBVAL *spec, REBVAL
 
 		/* set type early such that GC will handle it correctly, i.e, not collect series in the struct */
 		SET_TYPE(out, REB_STRUCT);
+		ENABLE_GC;
 
 		if (IS_BLOCK(blk)) {
 			parse_attr(blk, &raw_size, &raw_addr);
@@ -796,6 +866,7 @@ static REBOOL parse_field_type(struct Struct_Field *field, REBVAL *spec, REBVAL
 
 		return TRUE;
 	}
+	ENABLE_GC;
 
 failed:
 	Free_Series(VAL_STRUCT_FIELDS(out));
@@ -807,19 +878,217 @@ failed:
 }
 
 
+/***********************************************************************
+**
+*/	static REBFLG Pick_Struct_Elem(REBVAL *arr, REBINT n, REBVAL *out)
+/*
+**		Set out to element n (1-based) of a struct array. The element
+**		is a view of the array's storage, so changing it changes the
+**		array. Returns FALSE when n is out of range.
+**
+***********************************************************************/
+{
+	if (n <= 0 || (REBCNT)n > VAL_STRUCT_COUNT(arr)) return FALSE;
+
+	Init_Struct_View(out, VAL_STRUCT_SPEC(arr), VAL_STRUCT_FIELDS(arr),
+		VAL_STRUCT_DATA_BIN(arr),
+		VAL_STRUCT_OFFSET(arr) + (n - 1) * VAL_STRUCT_LEN(arr),
+		VAL_STRUCT_LEN(arr), 0);
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Poke_Struct_Elem(REBVAL *arr, REBVAL *index, REBVAL *val)
+/*
+***********************************************************************/
+{
+	REBINT n = Int32(index);
+	REBCNT len = VAL_STRUCT_LEN(arr);
+
+	if (n <= 0 || (REBCNT)n > VAL_STRUCT_COUNT(arr)) Trap_Range(index);
+
+	if (!IS_STRUCT(val)
+		|| VAL_STRUCT_LEN(val) != len
+		|| !same_fields(VAL_STRUCT_FIELDS(arr), VAL_STRUCT_FIELDS(val)))
+		Trap_Arg(val);
+
+	memmove(SERIES_SKIP(VAL_STRUCT_DATA_BIN(arr), VAL_STRUCT_OFFSET(arr) + (n - 1) * len),
+		SERIES_SKIP(VAL_STRUCT_DATA_BIN(val), VAL_STRUCT_OFFSET(val)), len);
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Field_Vector_Type(struct Struct_Field *field, REBINT *type, REBINT *sign)
+/*
+**		Get the vector type that holds the C type of a scalar field.
+**		The vector's bits are the field's size. Returns FALSE for
+**		fields that have no such vector (arrays, structs).
+**
+***********************************************************************/
+{
+	if (field->array) return FALSE;
+
+	*type = 0;
+	*sign = 0;
+	switch (field->type) {
+		case STRUCT_TYPE_UINT8:
+		case STRUCT_TYPE_UINT16:
+		case STRUCT_TYPE_UINT32:
+		case STRUCT_TYPE_UINT64:
+		case STRUCT_TYPE_POINTER:
+			*sign = 1;
+		case STRUCT_TYPE_INT8:
+		case STRUCT_TYPE_INT16:
+		case STRUCT_TYPE_INT32:
+		case STRUCT_TYPE_INT64:
+			break;
+		case STRUCT_TYPE_FLOAT:
+		case STRUCT_TYPE_DOUBLE:
+			*type = 1;
+			break;
+		default:
+			return FALSE;
+	}
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Get_Struct_Column(REBVAL *arr, struct Struct_Field *field, REBVAL *out)
+/*
+**		Get a field of every element of a struct array: a vector for
+**		scalar fields (copied with a strided loop), else a block.
+**
+***********************************************************************/
+{
+	REBCNT count = VAL_STRUCT_COUNT(arr);
+	REBCNT len = VAL_STRUCT_LEN(arr);
+	REBINT type, sign;
+	REBSER *ser;
+	REBCNT n;
+
+	if (Field_Vector_Type(field, &type, &sign)) {
+		REBCNT size = field->size;
+		REBYTE *src;
+		REBYTE *dst;
+
+		ser = Make_Vector(type, sign, 0, size * 8, count);
+		src = SERIES_SKIP(VAL_STRUCT_DATA_BIN(arr), VAL_STRUCT_OFFSET(arr) + field->offset);
+		dst = SERIES_DATA(ser);
+		for (n = 0; n < count; n++, src += len, dst += size) memcpy(dst, src, size);
+		Set_Series(REB_VECTOR, out, ser);
+		return;
+	}
+
+	// Elements are made on the stack, the result is kept there too:
+	ser = Make_Block(count);
+	DS_PUSH_NONE;
+	Set_Block(DS_TOP, ser);
+	for (n = 1; n <= count; n++) {
+		DS_PUSH_NONE;
+		Pick_Struct_Elem(arr, n, DS_TOP);
+		Get_Struct_Field(&VAL_STRUCT(DS_TOP), field, DS_TOP);
+		Append_Val(ser, DS_TOP);
+		DS_DROP;
+	}
+	*out = *DS_POP;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Set_Struct_Column(REBVAL *arr, struct Struct_Field *field, REBVAL *val)
+/*
+**		Set a field of every element of a struct array from a vector
+**		or block with one value per element, or from a single value.
+**		A vector of the field's own C type is copied without conversion.
+**
+***********************************************************************/
+{
+	REBCNT count = VAL_STRUCT_COUNT(arr);
+	REBCNT len = VAL_STRUCT_LEN(arr);
+	REBYTE *dst = SERIES_SKIP(VAL_STRUCT_DATA_BIN(arr), VAL_STRUCT_OFFSET(arr) + field->offset);
+	REBINT type, sign;
+	REBCNT n;
+
+	if (IS_VECTOR(val) || IS_BLOCK(val)) {
+		if (field->array || VAL_LEN(val) != count) return FALSE;
+	}
+
+	if (IS_VECTOR(val)) {
+		REBSER *vect = VAL_SERIES(val);
+		REBCNT size = field->size;
+		REBCNT bits = size == 1 ? 0 : size == 2 ? 1 : size == 4 ? 2 : 3;
+
+		if (Field_Vector_Type(field, &type, &sign)
+			&& (vect->size & 0xff) == (REBCNT)((type << 3) | (sign << 2) | bits)) {
+			REBYTE *src = VAL_DATA(val);
+			for (n = 0; n < count; n++, src += size, dst += len) memcpy(dst, src, size);
+		}
+		else {
+			REBVAL tmp;
+			for (n = 0; n < count; n++, dst += len) {
+				Set_Vector_Value(&tmp, vect, VAL_INDEX(val) + n);
+				if (!assign_data(field, dst, &tmp)) return FALSE;
+			}
+		}
+	}
+	else if (IS_BLOCK(val)) {
+		for (n = 0; n < count; n++, dst += len) {
+			if (!assign_data(field, dst, VAL_BLK_SKIP(val, n))) return FALSE;
+		}
+	}
+	else {
+		// Convert once, then copy the bytes to the other elements:
+		if (field->array || !assign_data(field, dst, val)) return FALSE;
+		for (n = 1; n < count; n++) memcpy(dst + n * len, dst, field->size);
+	}
+	return TRUE;
+}
+
+
 /***********************************************************************
 **
 */	REBINT PD_Struct(REBPVS *pvs)
 /*
+**		A struct array takes an index, giving the element, or a field
+**		name, giving that field of all elements (see Get_Struct_Column).
+**
 ***********************************************************************/
 {
 	struct Struct_Field *field = NULL;
-	REBCNT i = 0;
 	REBSTU *stu = &VAL_STRUCT(pvs->value);
+	REBFLG at_end = !pvs->path || IS_END(pvs->path + 1); // PICK has no path
+
+	if (VAL_STRUCT_COUNT(pvs->value)) {
+		if (IS_INTEGER(pvs->select)) {
+			if (pvs->setval && at_end) {
+				Poke_Struct_Elem(pvs->value, pvs->select, pvs->setval);
+				return PE_OK;
+			}
+			if (!Pick_Struct_Elem(pvs->value, Int32(pvs->select), pvs->store))
+				return PE_NONE;
+			return PE_USE;
+		}
+		if (!IS_WORD(pvs->select)
+			|| !(field = Find_Struct_Field(stu->fields, VAL_WORD_CANON(pvs->select))))
+			return PE_BAD_SELECT;
+		if (pvs->setval && at_end) {
+			if (!Set_Struct_Column(pvs->value, field, pvs->setval)) return PE_BAD_SET;
+			return PE_OK;
+		}
+		Get_Struct_Column(pvs->value, field, pvs->store);
+		return PE_USE;
+	}
+
 	if (!IS_WORD(pvs->select)) {
 		return PE_BAD_SELECT;
 	}
-	if (! pvs->setval || NOT_END(pvs->path + 1)) {
+	if (! pvs->setval || !at_end) {
 		if (!Get_Struct_Var(stu, pvs->select, pvs->store)) {
 			return PE_BAD_SELECT;
 		}
@@ -877,7 +1146,10 @@ REBINT Cmp_Struct(REBVAL *s, REBVAL *t)
 			return IS_STRUCT(a) && IS_STRUCT(b)
 				 && same_fields(VAL_STRUCT_FIELDS(a), VAL_STRUCT_FIELDS(b))
 				 && VAL_STRUCT_LEN(a) == VAL_STRUCT_LEN(b)
-				 && !memcmp(SERIES_DATA(VAL_STRUCT_DATA_BIN(a)), SERIES_DATA(VAL_STRUCT_DATA_BIN(b)), VAL_STRUCT_LEN(a));
+				 && VAL_STRUCT_COUNT(a) == VAL_STRUCT_COUNT(b)
+				 && !memcmp(SERIES_SKIP(VAL_STRUCT_DATA_BIN(a), VAL_STRUCT_OFFSET(a)),
+						SERIES_SKIP(VAL_STRUCT_DATA_BIN(b), VAL_STRUCT_OFFSET(b)),
+						VAL_STRUCT_LEN(a) * MAX(1, VAL_STRUCT_COUNT(a)));
 		default:
 			return -1;
 	}
@@ -902,6 +1174,54 @@ void Copy_Struct_Val(REBVAL *src, REBVAL *dst)
 	Copy_Struct(&VAL_STRUCT(src), &VAL_STRUCT(dst));
 }
 
+/***********************************************************************
+**
+*/	static REBOOL Has_Rebval_Field(REBSER *fields)
+/*
+***********************************************************************/
+{
+	struct Struct_Field *field = (struct Struct_Field *)SERIES_DATA(fields);
+	REBCNT i;
+
+	for (i = 0; i < SERIES_TAIL(fields); i++, field++) {
+		if (field->type == STRUCT_TYPE_REBVAL
+			|| (field->type == STRUCT_TYPE_STRUCT && Has_Rebval_Field(field->fields)))
+			return TRUE;
+	}
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Make_Struct_Array(REBVAL *out, REBVAL *proto, REBVAL *count)
+/*
+**		MAKE a-struct count: an array of count copies of the struct,
+**		laid out in one binary as C lays out an array of the struct.
+**		Elements are picked as views of that binary, and a routine
+**		gets the binary's address for a pointer argument.
+**
+***********************************************************************/
+{
+	REBINT n = Int32s(count, 1);
+	REBCNT len = VAL_STRUCT_LEN(proto);
+	REBYTE *src;
+	REBSER *bin;
+	REBINT i;
+
+	// The GC marks rebval fields of a single struct only:
+	if (Has_Rebval_Field(VAL_STRUCT_FIELDS(proto))) Trap_Arg(proto);
+	if ((u64)len * n > VAL_STRUCT_LIMIT) Trap1(RE_SIZE_LIMIT, count);
+
+	bin = Make_Series(len * n, 1, FALSE);
+	BARE_SERIES(bin);
+	src = SERIES_SKIP(VAL_STRUCT_DATA_BIN(proto), VAL_STRUCT_OFFSET(proto));
+	for (i = 0; i < n; i++) memcpy(BIN_SKIP(bin, i * len), src, len);
+	SERIES_TAIL(bin) = len * n;
+
+	Init_Struct_View(out, VAL_STRUCT_SPEC(proto), VAL_STRUCT_FIELDS(proto), bin, 0, len, n);
+}
+
 /* a: make struct! [uint 8 i: 1]
  * b: make a [i: 10]
  */
@@ -912,7 +1232,6 @@ static void init_fields(REBVAL *ret, REBVAL *spec)
 	for (blk = VAL_BLK_DATA(spec); NOT_END(blk); blk += 2) {
 		struct Struct_Field *fld = NULL;
 		REBSER *fields = VAL_STRUCT_FIELDS(ret);
-		int i = 0;
 		REBVAL *word = blk;
 		REBVAL *fld_val = blk + 1;
 
@@ -936,39 +1255,34 @@ static void init_fields(REBVAL *ret, REBVAL *spec)
 			Trap1(RE_NEED_VALUE, fld_val);
 		}
 
-		for (i = 0; i < SERIES_TAIL(fields); i ++) {
-			fld = (struct Struct_Field*)SERIES_SKIP(fields, i);
-			if (fld->sym == VAL_WORD_CANON(word)) {
-				if (fld->dimension > 1) {
-					REBCNT n = 0;
-					if (IS_BLOCK(fld_val)) {
-						if (VAL_LEN(fld_val) != fld->dimension) {
-							Trap_Arg(fld_val);
-						}
-						for(n = 0; n < fld->dimension; n ++) {
-							if (!assign_scalar(&VAL_STRUCT(ret), fld, n, VAL_BLK_SKIP(fld_val, n))) {
-								Trap_Arg(fld_val);
-							}
-						}
-					} else if (IS_INTEGER(fld_val)) {
-						void *ptr = (void *)VAL_INT64(fld_val);
+		fld = Find_Struct_Field(fields, VAL_WORD_CANON(word));
+		if (!fld) {
+			Trap_Arg(word); /* field not found in the parent struct */
+		}
 
-						/* assuming it's an valid pointer and holding enough space */
-						memcpy(SERIES_SKIP(VAL_STRUCT_DATA_BIN(ret), fld->offset), ptr, fld->size * fld->dimension);
-					} else {
-						Trap_Arg(fld_val);
-					}
-				} else {
-					if (!assign_scalar(&VAL_STRUCT(ret), fld, 0, fld_val)) {
+		if (fld->dimension > 1) {
+			REBCNT n = 0;
+			if (IS_BLOCK(fld_val)) {
+				if (VAL_LEN(fld_val) != fld->dimension) {
+					Trap_Arg(fld_val);
+				}
+				for(n = 0; n < fld->dimension; n ++) {
+					if (!assign_scalar(&VAL_STRUCT(ret), fld, n, VAL_BLK_SKIP(fld_val, n))) {
 						Trap_Arg(fld_val);
 					}
 				}
-				break;
-			}
-		}
+			} else if (IS_INTEGER(fld_val)) {
+				void *ptr = (void *)VAL_INT64(fld_val);
 
-		if (i == SERIES_TAIL(fields)) {
-			Trap_Arg(word); /* field not found in the parent struct */
+				/* assuming it's an valid pointer and holding enough space */
+				memcpy(SERIES_SKIP(VAL_STRUCT_DATA_BIN(ret), fld->offset), ptr, fld->size * fld->dimension);
+			} else {
+				Trap_Arg(fld_val);
+			}
+		} else {
+			if (!assign_scalar(&VAL_STRUCT(ret), fld, 0, fld_val)) {
+				Trap_Arg(fld_val);
+			}
 		}
 	}
 }
@@ -998,6 +1312,10 @@ static void init_fields(REBVAL *ret, REBVAL *spec)
 
 			// Clone an existing STRUCT:
 			if (IS_STRUCT(val)) {
+				if (IS_INTEGER(arg)) {
+					Make_Struct_Array(ret, val, arg);
+					break;
+				}
 				Copy_Struct_Val(val, ret);
 
 				/* only accept value initialization */
@@ -1025,12 +1343,15 @@ static void init_fields(REBVAL *ret, REBVAL *spec)
 					Trap_Types(RE_EXPECT_VAL, REB_BINARY, VAL_TYPE(arg));
 				}
 
-				if (VAL_LEN(arg) != SERIES_TAIL(VAL_STRUCT_DATA_BIN(val))) {
+				// Only the struct's own part of the data (as for VALUES),
+				// which an element of a struct array shares with the rest:
+				REBCNT len = VAL_STRUCT_LEN(val) * MAX(1, VAL_STRUCT_COUNT(val));
+				if (VAL_LEN(arg) != len) {
 					Trap_Arg(arg);
 				}
-				memcpy(SERIES_DATA(VAL_STRUCT_DATA_BIN(val)),
-					   SERIES_DATA(VAL_SERIES(arg)),
-					   SERIES_TAIL(VAL_STRUCT_DATA_BIN(val)));
+				memcpy(SERIES_SKIP(VAL_STRUCT_DATA_BIN(val), VAL_STRUCT_OFFSET(val)),
+					   VAL_BIN_DATA(arg),
+					   len);
 			}
 			break;
 		case A_REFLECT:
@@ -1038,7 +1359,8 @@ static void init_fields(REBVAL *ret, REBVAL *spec)
 				REBINT n = VAL_WORD_CANON(arg); // zero on error
 				switch (n) {
 					case SYM_VALUES:
-						SET_BINARY(ret, Copy_Series_Part(VAL_STRUCT_DATA_BIN(val), VAL_STRUCT_OFFSET(val), VAL_STRUCT_LEN(val)));
+						SET_BINARY(ret, Copy_Series_Part(VAL_STRUCT_DATA_BIN(val), VAL_STRUCT_OFFSET(val),
+							VAL_STRUCT_LEN(val) * MAX(1, VAL_STRUCT_COUNT(val))));
 						break;
 					case SYM_SPEC:
 						Set_Block(ret, Clone_Block(VAL_STRUCT_SPEC(val)));
@@ -1054,8 +1376,22 @@ static void init_fields(REBVAL *ret, REBVAL *spec)
 			break;
 
 		case A_LENGTHQ:
-			SET_INTEGER(ret, SERIES_TAIL(VAL_STRUCT_DATA_BIN(val)));
+			if (VAL_STRUCT_COUNT(val)) // elements of an array
+				SET_INTEGER(ret, VAL_STRUCT_COUNT(val));
+			else
+				SET_INTEGER(ret, SERIES_TAIL(VAL_STRUCT_DATA_BIN(val)));
 			break;
+
+		case A_PICK:
+			if (!VAL_STRUCT_COUNT(val)) Trap_Action(REB_STRUCT, action);
+			Pick_Path(val, arg, 0);
+			return R_TOS;
+
+		case A_POKE:
+			if (!VAL_STRUCT_COUNT(val)) Trap_Action(REB_STRUCT, action);
+			Pick_Path(val, arg, D_ARG(3));
+			return R_ARG3;
+
 		default:
 			Trap_Action(REB_STRUCT, action);
 	}
@@ -0,0 +1,836 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  t-table.c
+**  Summary: table datatype (columnar records)
+**  Section: datatypes
+**  Notes:
+**    A table is a block with a record of TBL_WIDE values per column.
+**    Numbers are kept in 64-bit vectors. Strings are dictionary
+**    encoded: the column holds 32-bit codes that index a block of
+**    the unique strings, which are protected so they can be shared.
+**
+**    make table! [id integer! price decimal! city string!]
+**    make table! [id integer! city string! [1 "Paris" 2 "Oslo"]]
+**
+***********************************************************************/
+
+#include "sys-core.h"
+#include "sys-int-funcs.h"
+
+// Values of a column record:
+enum {
+	TBL_NAME,	// word!
+	TBL_TYPE,	// datatype! of the column: integer!, decimal! or string!
+	TBL_DATA,	// vector! of the values (or the codes of strings)
+	TBL_DICT,	// block! of the unique strings of a string column
+	TBL_HASH,	// vector! hash table for the dict
+	TBL_WIDE
+};
+
+#define TBL_COLS(s)		(SERIES_TAIL(s) / TBL_WIDE)
+#define TBL_COLUMN(s,n)	BLK_SKIP(s, (n) * TBL_WIDE)
+#define TBL_KIND(c)		VAL_DATATYPE((c) + TBL_TYPE)
+#define TBL_DATA_SER(c)	VAL_SERIES((c) + TBL_DATA)
+
+
+/***********************************************************************
+**
+*/	REBCNT Table_Rows(REBSER *tbl)
+/*
+**		A table of no columns (e.g. from PICK t []) has no rows.
+**
+***********************************************************************/
+{
+	if (!TBL_COLS(tbl)) return 0;
+	return SERIES_TAIL(TBL_DATA_SER(TBL_COLUMN(tbl, 0)));
+}
+
+
+/***********************************************************************
+**
+*/	void Table_Cell(REBSER *tbl, REBCNT col, REBCNT row, REBVAL *out)
+/*
+**		Get the value of a cell, or NONE if out of range.
+**
+***********************************************************************/
+{
+	REBVAL *column;
+	REBYTE *data;
+
+	if (col >= TBL_COLS(tbl) || row >= Table_Rows(tbl)) {
+		SET_NONE(out);
+		return;
+	}
+
+	column = TBL_COLUMN(tbl, col);
+	data = TBL_DATA_SER(column)->data;
+
+	switch (TBL_KIND(column)) {
+	case REB_INTEGER:
+		SET_INTEGER(out, ((REBI64*)data)[row]);
+		break;
+	case REB_DECIMAL:
+		SET_DECIMAL(out, ((REBDEC*)data)[row]);
+		break;
+	default:
+		*out = *BLK_SKIP(VAL_SERIES(column + TBL_DICT), ((REBCNT*)data)[row]);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Make_Column_Data(REBCNT kind, REBCNT len)
+/*
+***********************************************************************/
+{
+	if (kind == REB_INTEGER) return Make_Vector(0, 0, 0, 64, len);
+	if (kind == REB_DECIMAL) return Make_Vector(1, 0, 0, 64, len);
+	return Make_Vector(0, 1, 0, 32, len); // dictionary codes
+}
+
+
+/***********************************************************************
+**
+*/	static REBVAL *Add_Column(REBSER *tbl, REBCNT sym, REBCNT kind, REBCNT len)
+/*
+**		Append a column of len rows (zero, or unset codes).
+**
+***********************************************************************/
+{
+	REBVAL *val;
+
+	val = Append_Value(tbl);
+	Init_Word(val, sym);
+	Set_Datatype(Append_Value(tbl), kind);
+	Set_Series(REB_VECTOR, Append_Value(tbl), Make_Column_Data(kind, len));
+	if (kind == REB_STRING) {
+		Set_Block(Append_Value(tbl), Make_Block(8));
+		Set_Series(REB_VECTOR, Append_Value(tbl), Make_Vector(0, 1, 0, 32, Get_Hash_Prime(16)));
+	}
+	else {
+		SET_NONE(Append_Value(tbl));
+		SET_NONE(Append_Value(tbl));
+	}
+
+	return TBL_COLUMN(tbl, TBL_COLS(tbl) - 1);
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Find_Column(REBSER *tbl, REBVAL *word)
+/*
+**		Index of the column named by word, or -1.
+**
+***********************************************************************/
+{
+	REBCNT n;
+
+	for (n = 0; n < TBL_COLS(tbl); n++) {
+		if (VAL_WORD_CANON(TBL_COLUMN(tbl, n)) == VAL_WORD_CANON(word)) return n;
+	}
+	return -1;
+}
+
+
+/***********************************************************************
+**
+*/	static REBVAL *Get_Column(REBSER *tbl, REBVAL *word)
+/*
+***********************************************************************/
+{
+	REBINT n = ANY_WORD(word) ? Find_Column(tbl, word) : -1;
+
+	if (n < 0) Trap_Arg(word);
+	return TBL_COLUMN(tbl, n);
+}
+
+
+/***********************************************************************
+**
+*/	static void Rehash_Dict(REBVAL *column)
+/*
+**		Make a larger hash table for the dict of a string column.
+**
+***********************************************************************/
+{
+	REBSER *dict = VAL_SERIES(column + TBL_DICT);
+	REBSER *hser;
+	REBCNT size;
+	REBCNT n;
+
+	size = Get_Hash_Prime((SERIES_TAIL(dict) + 1) * 4);
+	if (!size) Trap_Num(RE_SIZE_LIMIT, SERIES_TAIL(dict));
+
+	hser = Make_Vector(0, 1, 0, 32, size);
+	for (n = 0; n < SERIES_TAIL(dict); n++)
+		((REBCNT*)hser->data)[Find_Key(dict, hser, BLK_SKIP(dict, n), 1, TRUE, 0)] = n + 1;
+
+	VAL_SERIES(column + TBL_HASH) = hser;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Dict_Code(REBVAL *column, REBVAL *str)
+/*
+**		Code of a string in a string column, adding it if new.
+**
+***********************************************************************/
+{
+	REBSER *dict = VAL_SERIES(column + TBL_DICT);
+	REBSER *hser;
+	REBCNT *hashes;
+	REBINT hash;
+	REBVAL *val;
+
+	// Keep the hash table at most half full:
+	if ((SERIES_TAIL(dict) + 1) * 2 > VAL_TAIL(column + TBL_HASH)) Rehash_Dict(column);
+	hser = VAL_SERIES(column + TBL_HASH);
+
+	hash = Find_Key(dict, hser, str, 1, TRUE, 0);
+	hashes = (REBCNT*)hser->data;
+	if (hashes[hash]) return hashes[hash] - 1;
+
+	val = Append_Value(dict);
+	Set_String(val, Copy_String(VAL_SERIES(str), VAL_INDEX(str), VAL_LEN(str)));
+	PROTECT_SERIES(VAL_SERIES(val));
+	hashes[hash] = SERIES_TAIL(dict);
+
+	return SERIES_TAIL(dict) - 1;
+}
+
+
+/***********************************************************************
+**
+*/	static void Append_Rows(REBSER *tbl, REBVAL *block)
+/*
+**		Append rows from a block of values, row after row. All of
+**		the values are checked before the table is changed.
+**
+***********************************************************************/
+{
+	REBCNT cols = TBL_COLS(tbl);
+	REBCNT len = VAL_LEN(block);
+	REBVAL *vals = VAL_BLK_DATA(block);
+	REBVAL *column;
+	REBVAL *val;
+	REBSER *ser;
+	REBCNT base;
+	REBCNT rows;
+	REBCNT kind;
+	REBCNT r, c;
+
+	// A table without columns cannot take rows:
+	if (!cols || len % cols) Trap_Arg(block);
+	rows = len / cols;
+
+	for (r = 0; r < len; r++) {
+		kind = TBL_KIND(TBL_COLUMN(tbl, r % cols));
+		val = vals + r;
+		if (VAL_TYPE(val) != kind && !(kind == REB_DECIMAL && IS_INTEGER(val)))
+			Trap_Types(RE_EXPECT_VAL, kind, VAL_TYPE(val));
+	}
+
+	base = Table_Rows(tbl);
+	if (base + rows > 0x7fffffff) Trap0(RE_PAST_END);
+
+	for (c = 0; c < cols; c++) {
+		column = TBL_COLUMN(tbl, c);
+		kind = TBL_KIND(column);
+		ser = TBL_DATA_SER(column);
+		Expand_Series(ser, AT_TAIL, rows);
+		for (r = 0, val = vals + c; r < rows; r++, val += cols) {
+			if (kind == REB_INTEGER)
+				((REBI64*)ser->data)[base + r] = VAL_INT64(val);
+			else if (kind == REB_DECIMAL)
+				((REBDEC*)ser->data)[base + r] = IS_INTEGER(val) ? (REBDEC)VAL_INT64(val) : VAL_DECIMAL(val);
+			else
+				((REBCNT*)ser->data)[base + r] = Dict_Code(column, val);
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Make_Table(REBVAL *val)
+/*
+**		Make a table from the values of a spec: column names and
+**		types, which can be followed by a block of rows. Returns 0
+**		if invalid.
+**
+***********************************************************************/
+{
+	REBSER *tbl = Make_Block(8 * TBL_WIDE);
+	REBINT kind;
+
+	for (; IS_WORD(val) || IS_SET_WORD(val); val += 2) {
+		if (IS_DATATYPE(val+1)) kind = VAL_DATATYPE(val+1);
+		else if (IS_WORD(val+1)) kind = VAL_WORD_CANON(val+1) - 1; // datatype word
+		else return 0;
+		if (kind != REB_INTEGER && kind != REB_DECIMAL && kind != REB_STRING) return 0;
+		if (Find_Column(tbl, val) >= 0) return 0;
+		Add_Column(tbl, VAL_WORD_SYM(val), kind, 0);
+	}
+
+	if (!TBL_COLS(tbl)) return 0;
+
+	if (IS_BLOCK(val)) Append_Rows(tbl, val++);
+	if (NOT_END(val)) return 0;
+
+	return tbl;
+}
+
+
+/***********************************************************************
+**
+*/	static void Copy_Dict(REBVAL *column, REBVAL *source)
+/*
+**		Give a string column the dict of another. The strings are
+**		protected, so a shallow copy of the dict is enough.
+**
+***********************************************************************/
+{
+	Set_Block(column + TBL_DICT, Copy_Block(VAL_SERIES(source + TBL_DICT), 0));
+	Set_Series(REB_VECTOR, column + TBL_HASH, Copy_Series(VAL_SERIES(source + TBL_HASH)));
+	VAL_SERIES(column + TBL_HASH)->size = VAL_SERIES(source + TBL_HASH)->size;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Gather_Rows(REBSER *tbl, REBCNT *rows, REBCNT count, REBVAL *columns)
+/*
+**		Make a table of the given rows of a table (all of them if
+**		rows is zero), with the given columns (all if none).
+**
+***********************************************************************/
+{
+	REBSER *out = Make_Block(TBL_COLS(tbl) * TBL_WIDE);
+	REBVAL *column;
+	REBVAL *col;
+	REBCNT wide;
+	REBYTE *src, *dst;
+	REBCNT c, r;
+
+	for (c = 0; c < (columns ? VAL_LEN(columns) : TBL_COLS(tbl)); c++) {
+		column = columns ? Get_Column(tbl, VAL_BLK_SKIP(columns, c)) : TBL_COLUMN(tbl, c);
+		if (Find_Column(out, column) >= 0) Trap_Arg(VAL_BLK_SKIP(columns, c));
+		col = Add_Column(out, VAL_WORD_SYM(column), TBL_KIND(column), count);
+		if (TBL_KIND(column) == REB_STRING) Copy_Dict(col, column);
+		wide = SERIES_WIDE(TBL_DATA_SER(column));
+		src = TBL_DATA_SER(column)->data;
+		dst = TBL_DATA_SER(col)->data;
+		if (!rows) COPY_MEM(dst, src, count * wide);
+		else if (wide == 8) {
+			for (r = 0; r < count; r++) ((REBU64*)dst)[r] = ((REBU64*)src)[rows[r]];
+		}
+		else {
+			for (r = 0; r < count; r++) ((REBCNT*)dst)[r] = ((REBCNT*)src)[rows[r]];
+		}
+	}
+
+	return out;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Pick_Table(REBSER *tbl, REBVAL *arg, REBVAL *out)
+/*
+**		Pick a row (as a block) by number, a column by name, or a
+**		table of some columns by a block of names. Numbers and
+**		strings of a column are returned as a read-only view of its
+**		vector, or a block. Returns FALSE if out of range.
+**
+***********************************************************************/
+{
+	REBSER *ser;
+	REBVAL *column;
+	REBINT n;
+	REBCNT i;
+
+	if (IS_INTEGER(arg) || IS_DECIMAL(arg)) {
+		n = Int32(arg) - 1;
+		if (n < 0 || (REBCNT)n >= Table_Rows(tbl)) return FALSE;
+		ser = Make_Block(TBL_COLS(tbl));
+		for (i = 0; i < TBL_COLS(tbl); i++) Table_Cell(tbl, i, n, Append_Value(ser));
+		Set_Block(out, ser);
+	}
+	else if (ANY_WORD(arg)) {
+		if ((n = Find_Column(tbl, arg)) < 0) return FALSE;
+		column = TBL_COLUMN(tbl, n);
+		if (TBL_KIND(column) == REB_STRING) {
+			ser = Make_Block(Table_Rows(tbl));
+			for (i = 0; i < Table_Rows(tbl); i++) Table_Cell(tbl, n, i, Append_Value(ser));
+			Set_Block(out, ser);
+		}
+		else {
+			*out = column[TBL_DATA];
+			VAL_SERIES(out) = Make_View_Series(VAL_SERIES(out), 0, Table_Rows(tbl));
+		}
+	}
+	else if (IS_BLOCK(arg)) {
+		Set_Series(REB_TABLE, out, Gather_Rows(tbl, 0, Table_Rows(tbl), arg));
+	}
+	else Trap_Arg(arg);
+
+	return TRUE;
+}
+
+
+// Sort order of rows (not re-entrant, as for Sort_Block):
+static struct {
+	REBCNT kind;
+	REBYTE *data;
+	REBCNT *rank;
+	REBSER *dict;
+	REBFLG reverse;
+} tbl_sort;
+
+/***********************************************************************
+**
+*/	static int Compare_Dict(const void *v1, const void *v2)
+/*
+***********************************************************************/
+{
+	REBCNT i = *(REBCNT*)v1;
+	REBCNT j = *(REBCNT*)v2;
+	REBINT n = Compare_String_Vals(BLK_SKIP(tbl_sort.dict, i), BLK_SKIP(tbl_sort.dict, j), TRUE);
+
+	if (n) return n;
+	return (i > j) - (i < j);
+}
+
+
+/***********************************************************************
+**
+*/	static int Compare_Rows(const void *v1, const void *v2)
+/*
+**		Order of two rows by the sort column. Equal rows keep their
+**		order, so the sort is stable.
+**
+***********************************************************************/
+{
+	REBCNT i = *(REBCNT*)v1;
+	REBCNT j = *(REBCNT*)v2;
+	REBINT n;
+
+	if (tbl_sort.kind == REB_INTEGER) {
+		REBI64 x = ((REBI64*)tbl_sort.data)[i], y = ((REBI64*)tbl_sort.data)[j];
+		n = (x > y) - (x < y);
+	}
+	else if (tbl_sort.kind == REB_DECIMAL) {
+		REBDEC x = ((REBDEC*)tbl_sort.data)[i], y = ((REBDEC*)tbl_sort.data)[j];
+		n = (x > y) - (x < y);
+	}
+	else {
+		REBCNT x = tbl_sort.rank[((REBCNT*)tbl_sort.data)[i]];
+		REBCNT y = tbl_sort.rank[((REBCNT*)tbl_sort.data)[j]];
+		n = (x > y) - (x < y);
+	}
+
+	if (tbl_sort.reverse) n = -n;
+	if (n) return n;
+	return (i > j) - (i < j);
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Sort_Rows(REBVAL *column, REBCNT rows, REBFLG reverse)
+/*
+**		Row numbers in the order of a column. Strings are ranked
+**		once through their dict, then the rows sort by rank.
+**
+***********************************************************************/
+{
+	REBSER *order = Make_Series(rows + 1, sizeof(REBCNT), FALSE);
+	REBSER *rank = 0;
+	REBCNT n;
+
+	if (TBL_KIND(column) == REB_STRING) {
+		REBSER *dict = VAL_SERIES(column + TBL_DICT);
+		REBSER *sorted = Make_Series(SERIES_TAIL(dict) + 1, sizeof(REBCNT), FALSE);
+		rank = Make_Series(SERIES_TAIL(dict) + 1, sizeof(REBCNT), FALSE);
+		for (n = 0; n < SERIES_TAIL(dict); n++) ((REBCNT*)sorted->data)[n] = n;
+		tbl_sort.dict = dict;
+		reb_qsort(sorted->data, SERIES_TAIL(dict), sizeof(REBCNT), Compare_Dict);
+		for (n = 0; n < SERIES_TAIL(dict); n++) ((REBCNT*)rank->data)[((REBCNT*)sorted->data)[n]] = n;
+		Free_Series(sorted);
+	}
+
+	for (n = 0; n < rows; n++) ((REBCNT*)order->data)[n] = n;
+	order->tail = rows;
+
+	tbl_sort.kind = TBL_KIND(column);
+	tbl_sort.data = TBL_DATA_SER(column)->data;
+	tbl_sort.rank = rank ? (REBCNT*)rank->data : 0;
+	tbl_sort.reverse = reverse;
+	reb_qsort(order->data, rows, sizeof(REBCNT), Compare_Rows);
+
+	if (rank) Free_Series(rank);
+	return order;
+}
+
+
+/***********************************************************************
+**
+*/	void Sort_Table(REBVAL *table, REBVAL *word, REBFLG reverse, REBVAL *out)
+/*
+***********************************************************************/
+{
+	REBSER *tbl = VAL_SERIES(table);
+	REBSER *order = Sort_Rows(Get_Column(tbl, word), Table_Rows(tbl), reverse);
+
+	Set_Series(REB_TABLE, out, Gather_Rows(tbl, (REBCNT*)order->data, order->tail, 0));
+	Free_Series(order);
+}
+
+
+/***********************************************************************
+**
+*/	void Filter_Table(REBVAL *table, REBVAL *word, REBINT mode, REBFLG invert, REBVAL *arg, REBVAL *out)
+/*
+**		Table of the rows where the column compares true with arg.
+**		Mode and invert are as for Mask_Vector. Numbers are compared
+**		by Mask_Vector, strings once per dict entry (not per row).
+**
+***********************************************************************/
+{
+	REBSER *tbl = VAL_SERIES(table);
+	REBVAL *column = Get_Column(tbl, word);
+	REBCNT rows = Table_Rows(tbl);
+	REBSER *match = Make_Series(rows + 1, sizeof(REBCNT), FALSE);
+	REBCNT *mp = (REBCNT*)match->data;
+	REBCNT count = 0;
+	REBYTE *flags;
+	REBVAL mask;
+	REBINT n;
+	REBCNT r;
+
+	if (TBL_KIND(column) == REB_STRING) {
+		REBSER *dict = VAL_SERIES(column + TBL_DICT);
+		REBCNT *codes = (REBCNT*)TBL_DATA_SER(column)->data;
+		REBSER *ser;
+		if (!ANY_STR(arg)) Trap_Arg(arg);
+		ser = Make_Series(SERIES_TAIL(dict) + 1, 1, FALSE);
+		flags = ser->data;
+		for (r = 0; r < SERIES_TAIL(dict); r++) {
+			n = Compare_String_Vals(BLK_SKIP(dict, r), arg, TRUE);
+			flags[r] = (REBYTE)(((mode == 0) ? (n == 0) : (mode == -1) ? (n >= 0) : (n > 0)) ^ invert);
+		}
+		for (r = 0; r < rows; r++) if (flags[codes[r]]) mp[count++] = r;
+		Free_Series(ser);
+	}
+	else {
+		if (!IS_INTEGER(arg) && !IS_DECIMAL(arg)) Trap_Arg(arg);
+		Mask_Vector(column + TBL_DATA, arg, mode, invert, &mask);
+		flags = VAL_SERIES(&mask)->data;
+		for (r = 0; r < rows; r++) if (flags[r]) mp[count++] = r;
+		Free_Series(VAL_SERIES(&mask));
+	}
+
+	Set_Series(REB_TABLE, out, Gather_Rows(tbl, mp, count, 0));
+	Free_Series(match);
+}
+
+
+/***********************************************************************
+**
+*/	void Group_Table(REBVAL *table, REBVAL *key, REBVAL *word, REBCNT agg, REBVAL *out)
+/*
+**		Table of the distinct values of the key column, in order,
+**		and an aggregate of the other column for each of them.
+**		The rows are sorted by key once, then each group is a run.
+**
+***********************************************************************/
+{
+	REBSER *tbl = VAL_SERIES(table);
+	REBVAL *kcol = Get_Column(tbl, key);
+	REBVAL *column = Get_Column(tbl, word);
+	REBCNT rows = Table_Rows(tbl);
+	REBCNT kind = TBL_KIND(column);
+	REBSER *order;
+	REBSER *starts;
+	REBSER *res;
+	REBVAL *col;
+	REBCNT *op;
+	REBCNT *sp;
+	REBYTE *kd = TBL_DATA_SER(kcol)->data;
+	REBYTE *data = TBL_DATA_SER(column)->data;
+	REBCNT kwide = SERIES_WIDE(TBL_DATA_SER(kcol));
+	REBCNT groups = 0;
+	REBCNT g, r, end;
+	REBCNT sym;
+
+	if (kind == REB_STRING && agg != AGG_COUNT) Trap_Arg(word);
+
+	order = Sort_Rows(kcol, rows, FALSE);
+	op = (REBCNT*)order->data;
+
+	// A group starts where the key changes:
+	starts = Make_Series(rows + 2, sizeof(REBCNT), FALSE);
+	sp = (REBCNT*)starts->data;
+	for (r = 0; r < rows; r++) {
+		if (r == 0 || memcmp(kd + op[r] * kwide, kd + op[r-1] * kwide, kwide))
+			sp[groups++] = r;
+	}
+	sp[groups] = rows;
+
+	// The key column, then the aggregate, named as the column:
+	res = Make_Block(2 * TBL_WIDE);
+	col = Add_Column(res, VAL_WORD_SYM(kcol), TBL_KIND(kcol), groups);
+	if (TBL_KIND(kcol) == REB_STRING) Copy_Dict(col, kcol);
+	for (g = 0; g < groups; g++)
+		COPY_MEM(TBL_DATA_SER(col)->data + g * kwide, kd + op[sp[g]] * kwide, kwide);
+
+	if (agg == AGG_COUNT) kind = REB_INTEGER;
+	else if (agg == AGG_MEAN) kind = REB_DECIMAL;
+	sym = VAL_WORD_SYM(column);
+	if (column == kcol) {
+		// Aggregate of the key itself is named as key-sum, key-count...:
+		static const char *agg_names[] = {"sum", "mean", "min", "max", "count"};
+		REBSER *name = Make_Binary(40);
+		Append_Bytes(name, Get_Sym_Name(sym));
+		Append_Byte(name, '-');
+		Append_Bytes(name, (REBYTE*)agg_names[agg]);
+		sym = Make_Word(BIN_HEAD(name), SERIES_TAIL(name));
+		Free_Series(name);
+	}
+	col = Add_Column(res, sym, kind, groups);
+
+	for (g = 0; g < groups; g++) {
+		end = sp[g+1];
+		r = sp[g];
+		if (agg == AGG_COUNT) {
+			((REBI64*)TBL_DATA_SER(col)->data)[g] = end - r;
+		}
+		else if (TBL_KIND(column) == REB_INTEGER && agg != AGG_MEAN) {
+			REBI64 *p = (REBI64*)data;
+			REBI64 n = p[op[r++]];
+			for (; r < end; r++) {
+				if (agg == AGG_SUM) {
+					if (REB_I64_ADD_OF(n, p[op[r]], &n)) Trap0(RE_OVERFLOW);
+				}
+				else if ((agg == AGG_MAX) ? (p[op[r]] > n) : (p[op[r]] < n)) n = p[op[r]];
+			}
+			((REBI64*)TBL_DATA_SER(col)->data)[g] = n;
+		}
+		else {
+			REBCNT first = r;
+			REBDEC n;
+			if (TBL_KIND(column) == REB_INTEGER) {
+				n = 0;
+				for (; r < end; r++) n += (REBDEC)((REBI64*)data)[op[r]];
+			}
+			else {
+				REBDEC *p = (REBDEC*)data;
+				n = p[op[r++]];
+				for (; r < end; r++) {
+					if (agg == AGG_SUM || agg == AGG_MEAN) n += p[op[r]];
+					else if ((agg == AGG_MAX) ? (p[op[r]] > n) : (p[op[r]] < n)) n = p[op[r]];
+				}
+			}
+			if (agg == AGG_MEAN) n /= end - first;
+			((REBDEC*)TBL_DATA_SER(col)->data)[g] = n;
+		}
+	}
+
+	Free_Series(order);
+	Free_Series(starts);
+	Set_Series(REB_TABLE, out, res);
+}
+
+
+/***********************************************************************
+**
+*/	REBINT CT_Table(REBVAL *a, REBVAL *b, REBINT mode)
+/*
+***********************************************************************/
+{
+	REBSER *t1 = VAL_SERIES(a);
+	REBSER *t2 = VAL_SERIES(b);
+	REBVAL v1, v2;
+	REBCNT c, r;
+
+	if (mode < 0) return -1;
+	if (t1 == t2) return TRUE;
+	if (mode == 3) return FALSE;
+	if (TBL_COLS(t1) != TBL_COLS(t2) || Table_Rows(t1) != Table_Rows(t2)) return FALSE;
+
+	for (c = 0; c < TBL_COLS(t1); c++) {
+		if (
+			VAL_WORD_CANON(TBL_COLUMN(t1, c)) != VAL_WORD_CANON(TBL_COLUMN(t2, c))
+			|| TBL_KIND(TBL_COLUMN(t1, c)) != TBL_KIND(TBL_COLUMN(t2, c))
+		) return FALSE;
+		for (r = 0; r < Table_Rows(t1); r++) {
+			Table_Cell(t1, c, r, &v1);
+			Table_Cell(t2, c, r, &v2);
+			if (Cmp_Value(&v1, &v2, mode > 0)) return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG MT_Table(REBVAL *out, REBVAL *data, REBCNT type)
+/*
+***********************************************************************/
+{
+	REBSER *tbl;
+
+	if (!(tbl = Make_Table(data))) return FALSE;
+	Set_Series(REB_TABLE, out, tbl);
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	REBINT PD_Table(REBPVS *pvs)
+/*
+**		table/3 is a row, table/name a column.
+**
+***********************************************************************/
+{
+	if (pvs->setval) return PE_BAD_SET;
+	if (!IS_INTEGER(pvs->select) && !ANY_WORD(pvs->select)) return PE_BAD_SELECT;
+	if (!Pick_Table(VAL_SERIES(pvs->value), pvs->select, pvs->store)) return PE_NONE;
+	return PE_USE;
+}
+
+
+/***********************************************************************
+**
+*/	REBTYPE(Table)
+/*
+***********************************************************************/
+{
+	REBVAL *value = D_ARG(1);
+	REBVAL *arg = D_ARG(2);
+	REBSER *tbl;
+	REBSER *ser;
+	REBCNT n;
+
+	if (action == A_MAKE || action == A_TO) {
+		if (IS_BLOCK(arg) && MT_Table(D_RET, VAL_BLK_DATA(arg), REB_TABLE)) return R_RET;
+		Trap_Make(REB_TABLE, arg);
+	}
+
+	tbl = VAL_SERIES(value);
+
+	switch (action) {
+
+	case A_LENGTHQ:
+		DS_RET_INT(Table_Rows(tbl));
+		break;
+
+	case A_PICK:
+	case A_SELECT:
+		if (!Pick_Table(tbl, arg, D_RET)) return R_NONE;
+		break;
+
+	case A_APPEND:
+		TRAP_PROTECT(tbl);
+		if (!IS_BLOCK(arg)) Trap_Arg(arg);
+		Append_Rows(tbl, arg);
+		return R_ARG1;
+
+	case A_CLEAR:
+		TRAP_PROTECT(tbl);
+		for (n = 0; n < TBL_COLS(tbl); n++) RESET_TAIL(TBL_DATA_SER(TBL_COLUMN(tbl, n)));
+		return R_ARG1;
+
+	case A_COPY:
+		Set_Series(REB_TABLE, D_RET, Gather_Rows(tbl, 0, Table_Rows(tbl), 0));
+		break;
+
+	case A_REFLECT:
+		n = What_Reflector(arg); // zero on error
+		if (n != OF_WORDS && n != OF_SPEC) Trap_Reflect(REB_TABLE, arg);
+		ser = Make_Block(TBL_COLS(tbl) * 2);
+		for (n = 0; n < TBL_COLS(tbl); n++) {
+			Append_Val(ser, TBL_COLUMN(tbl, n));
+			if (What_Reflector(arg) == OF_SPEC)
+				Init_Word(Append_Value(ser), TBL_KIND(TBL_COLUMN(tbl, n)) + 1);
+		}
+		Set_Block(D_RET, ser);
+		break;
+
+	default:
+		Trap_Action(REB_TABLE, action);
+	}
+
+	return R_RET;
+}
+
+
+/***********************************************************************
+**
+*/	void Mold_Table(REBVAL *value, REB_MOLD *mold, REBFLG molded)
+/*
+**		Molds as the spec followed by the rows, one per line.
+**		Forms as just the rows.
+**
+***********************************************************************/
+{
+	REBSER *tbl = VAL_SERIES(value);
+	REBCNT rows = Table_Rows(tbl);
+	REBCNT cols = TBL_COLS(tbl);
+	REBVAL *column;
+	REBVAL cell;
+	REBCNT c, r;
+
+	if (molded) {
+		Pre_Mold(value, mold);
+		if (!GET_MOPT(mold, MOPT_MOLD_ALL)) Append_Byte(mold->series, '[');
+		for (c = 0; c < cols; c++) {
+			column = TBL_COLUMN(tbl, c);
+			Emit(mold, "N N ", VAL_WORD_SYM(column), TBL_KIND(column) + 1);
+		}
+		Append_Byte(mold->series, '[');
+		mold->indent++;
+	}
+
+	for (r = 0; r < rows; r++) {
+		if (molded || r > 0) New_Indented_Line(mold);
+		for (c = 0; c < cols; c++) {
+			if (c) Append_Byte(mold->series, ' ');
+			Table_Cell(tbl, c, r, &cell);
+			Mold_Value(mold, &cell, molded);
+		}
+	}
+
+	if (molded) {
+		mold->indent--;
+		if (rows) New_Indented_Line(mold);
+		Append_Byte(mold->series, ']');
+		if (!GET_MOPT(mold, MOPT_MOLD_ALL)) Append_Byte(mold->series, ']');
+		else Post_Mold(value, mold);
+	}
+}
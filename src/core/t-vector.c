@@ -28,12 +28,14 @@
 ***********************************************************************/
 
 #include "sys-core.h"
+#include "sys-int-funcs.h"
 
 #define	SET_VECTOR(v,s) VAL_SERIES(v)=(s), VAL_INDEX(v)=0, VAL_SET(v, REB_VECTOR)
 
 // Encoding Format:
 //		stored in series->size for now
-//		[d d d d   d d d d   0 0 0 0   t s b b]
+//		[c c c c   c c c c   0 0 0 0   t s b b]
+//		c: columns of a matrix (row-major), zero for a plain vector
 
 // Encoding identifiers:
 enum {
@@ -54,6 +56,8 @@ enum {
 };
 
 #define VECT_TYPE(s) ((s)->size & 0xff)
+#define VECT_COLS(s) ((s)->size >> 8)
+#define SET_VECT_COLS(s,c) ((s)->size = VECT_TYPE(s) | ((c) << 8))
 
 static REBCNT bit_sizes[4] = {8, 16, 32, 64};
 
@@ -153,6 +157,278 @@ void set_vect(REBCNT bits, REBYTE *data, REBCNT n, REBI64 i, REBDEC f) {
 	}
 }
 
+/***********************************************************************
+**
+**	Element-wise Kernels
+**
+**		One loop per storage type, selected at runtime through the
+**		Vect_Kernels table by the VECT_TYPE of the target. The loops
+**		hold no calls or conversions so the compiler can emit SIMD
+**		code for them. Integer math wraps at the element width, as in
+**		C. A kernel returns FALSE on a zero divisor.
+**
+***********************************************************************/
+
+typedef REBFLG (*VECT_KERNEL)(REBCNT action, REBYTE *dst, REBYTE *a, REBYTE *b, REBCNT len, REBFLG scalar);
+
+// Signed MIN / -1 is undefined in C, so negate it (wraps) instead:
+#define VECT_DIV(T,U,S,x,y) (((S) && (y) == (T)-1) ? (T)((U)0 - (U)(x)) : (T)((x) / (y)))
+
+#define VECT_INT_KERNEL(name, T, U, S) \
+static REBFLG name(REBCNT action, REBYTE *dst, REBYTE *a, REBYTE *b, REBCNT len, REBFLG scalar) \
+{ \
+	T *dp = (T*)dst; \
+	T *ap = (T*)a; \
+	T *bp = (T*)b; \
+	T k = *bp; \
+	REBCNT n; \
+	switch (action) { \
+	case A_ADD: \
+		if (scalar) for (n = 0; n < len; n++) dp[n] = (T)((U)ap[n] + (U)k); \
+		else for (n = 0; n < len; n++) dp[n] = (T)((U)ap[n] + (U)bp[n]); \
+		break; \
+	case A_SUBTRACT: \
+		if (scalar) for (n = 0; n < len; n++) dp[n] = (T)((U)ap[n] - (U)k); \
+		else for (n = 0; n < len; n++) dp[n] = (T)((U)ap[n] - (U)bp[n]); \
+		break; \
+	case A_MULTIPLY: \
+		if (scalar) for (n = 0; n < len; n++) dp[n] = (T)((U)ap[n] * (U)k); \
+		else for (n = 0; n < len; n++) dp[n] = (T)((U)ap[n] * (U)bp[n]); \
+		break; \
+	case A_DIVIDE: \
+		if (scalar) { \
+			if (k == 0) return FALSE; \
+			for (n = 0; n < len; n++) dp[n] = VECT_DIV(T, U, S, ap[n], k); \
+		} \
+		else { \
+			for (n = 0; n < len; n++) if (bp[n] == 0) return FALSE; \
+			for (n = 0; n < len; n++) dp[n] = VECT_DIV(T, U, S, ap[n], bp[n]); \
+		} \
+		break; \
+	} \
+	return TRUE; \
+}
+
+#define VECT_FLT_KERNEL(name, T) \
+static REBFLG name(REBCNT action, REBYTE *dst, REBYTE *a, REBYTE *b, REBCNT len, REBFLG scalar) \
+{ \
+	T *dp = (T*)dst; \
+	T *ap = (T*)a; \
+	T *bp = (T*)b; \
+	T k = *bp; \
+	REBCNT n; \
+	switch (action) { \
+	case A_ADD: \
+		if (scalar) for (n = 0; n < len; n++) dp[n] = ap[n] + k; \
+		else for (n = 0; n < len; n++) dp[n] = ap[n] + bp[n]; \
+		break; \
+	case A_SUBTRACT: \
+		if (scalar) for (n = 0; n < len; n++) dp[n] = ap[n] - k; \
+		else for (n = 0; n < len; n++) dp[n] = ap[n] - bp[n]; \
+		break; \
+	case A_MULTIPLY: \
+		if (scalar) for (n = 0; n < len; n++) dp[n] = ap[n] * k; \
+		else for (n = 0; n < len; n++) dp[n] = ap[n] * bp[n]; \
+		break; \
+	case A_DIVIDE: \
+		if (scalar) { \
+			if (k == 0) return FALSE; \
+			for (n = 0; n < len; n++) dp[n] = ap[n] / k; \
+		} \
+		else { \
+			for (n = 0; n < len; n++) if (bp[n] == 0) return FALSE; \
+			for (n = 0; n < len; n++) dp[n] = ap[n] / bp[n]; \
+		} \
+		break; \
+	} \
+	return TRUE; \
+}
+
+VECT_INT_KERNEL(Vect_SI08, i8,  REBCNT, 1)
+VECT_INT_KERNEL(Vect_SI16, i16, REBCNT, 1)
+VECT_INT_KERNEL(Vect_SI32, i32, REBCNT, 1)
+VECT_INT_KERNEL(Vect_SI64, i64, REBU64, 1)
+VECT_INT_KERNEL(Vect_UI08, u8,  REBCNT, 0)
+VECT_INT_KERNEL(Vect_UI16, u16, REBCNT, 0)
+VECT_INT_KERNEL(Vect_UI32, u32, REBCNT, 0)
+VECT_INT_KERNEL(Vect_UI64, u64, REBU64, 0)
+VECT_FLT_KERNEL(Vect_SF32, float)
+VECT_FLT_KERNEL(Vect_SF64, double)
+
+static const VECT_KERNEL Vect_Kernels[] = {
+	Vect_SI08, Vect_SI16, Vect_SI32, Vect_SI64,
+	Vect_UI08, Vect_UI16, Vect_UI32, Vect_UI64,
+	0,         0,         Vect_SF32, Vect_SF64
+};
+
+// Apply a typed loop body to the data of any vector type:
+#define VECT_SWITCH(type, CASE) \
+	switch (type) { \
+	case VTSI08: CASE(i8);  break; \
+	case VTSI16: CASE(i16); break; \
+	case VTSI32: CASE(i32); break; \
+	case VTSI64: CASE(i64); break; \
+	case VTUI08: CASE(u8);  break; \
+	case VTUI16: CASE(u16); break; \
+	case VTUI32: CASE(u32); break; \
+	case VTUI64: CASE(u64); break; \
+	case VTSF32: CASE(float);  break; \
+	case VTSF64: CASE(double); break; \
+	}
+
+
+/***********************************************************************
+**
+*/	static REBDEC get_vect_dec(REBCNT type, REBYTE *data, REBCNT n)
+/*
+**		Get a vector element as a decimal, whatever its type.
+**
+***********************************************************************/
+{
+	union {REBU64 i; REBDEC d;} v;
+
+	v.i = get_vect(type, data, n);
+	if (type >= VTSF08) return v.d;
+	if (type == VTUI64) return (REBDEC)v.i;
+	return (REBDEC)(REBI64)v.i;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Vect_Scalar(REBCNT type, REBVAL *arg, REBYTE *buf)
+/*
+**		Store a number as a single element of the given type, so it
+**		can be passed to a kernel. Returns FALSE if the element can
+**		not hold the value exactly (caller must take the slow path).
+**
+***********************************************************************/
+{
+	REBI64 i;
+
+	if (type >= VTSF08) {
+		set_vect(type, buf, 0, 0, IS_INTEGER(arg) ? (REBDEC)VAL_INT64(arg) : VAL_DECIMAL(arg));
+		return TRUE;
+	}
+
+	if (!IS_INTEGER(arg)) return FALSE;
+	i = VAL_INT64(arg);
+	set_vect(type, buf, 0, i, 0);
+	return (REBI64)get_vect(type, buf, 0) == i;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Make_Vector_As(REBSER *vect, REBCNT len)
+/*
+**		Make an uninitialized vector of the same type as another.
+**
+***********************************************************************/
+{
+	REBSER *ser;
+
+	ser = Make_Series(len+1, SERIES_WIDE(vect), FALSE);
+	LABEL_SERIES(ser, "make vector");
+	ser->tail = len;
+	ser->size = vect->size;
+	if (VECT_COLS(vect) && (len % VECT_COLS(vect))) SET_VECT_COLS(ser, 0);
+
+	return ser;
+}
+
+
+/***********************************************************************
+**
+*/	static void Math_Vector(REBVAL *value, REBVAL *arg, REBCNT action)
+/*
+**		Element-wise ADD, SUBTRACT, MULTIPLY and DIVIDE of a vector
+**		with another vector (of the same length) or a number. The
+**		result is a new vector of the type of the first argument,
+**		stored back into value.
+**
+**		Same-typed operands go through the kernels; mixed types are
+**		computed per element as integers or decimals.
+**
+***********************************************************************/
+{
+	REBSER *vect = VAL_SERIES(value);
+	REBCNT type = VECT_TYPE(vect);
+	REBCNT len = VAL_LEN(value);
+	REBYTE *a = VAL_DATA(value);
+	REBYTE *b = 0;
+	REBCNT btype = 0;
+	REBFLG scalar = FALSE;
+	REBFLG fast = FALSE;
+	REBU64 buf; // holds one scalar element
+	REBSER *ser;
+	REBYTE *dst;
+	REBCNT n;
+
+	if (IS_VECTOR(arg)) {
+		if (VAL_LEN(arg) != len) Trap_Arg(arg);
+		b = VAL_DATA(arg);
+		btype = VECT_TYPE(VAL_SERIES(arg));
+		scalar = FALSE;
+		fast = (btype == type);
+	}
+	else if (IS_INTEGER(arg) || IS_DECIMAL(arg) || IS_PERCENT(arg)) {
+		b = (REBYTE*)&buf;
+		btype = IS_INTEGER(arg) ? VTSI64 : VTSF64;
+		scalar = TRUE;
+		fast = Vect_Scalar(type, arg, b);
+	}
+	else Trap_Math_Args(REB_VECTOR, action);
+
+	ser = Make_Vector_As(vect, len);
+	dst = BIN_HEAD(ser);
+
+	if (fast) {
+		if (!Vect_Kernels[type](action, dst, a, b, len, scalar)) Trap0(RE_ZERO_DIVIDE);
+	}
+	else if (type >= VTSF08 || btype >= VTSF08) {
+		REBDEC x, y;
+		for (n = 0; n < len; n++) {
+			x = get_vect_dec(type, a, n);
+			y = scalar ? (IS_INTEGER(arg) ? (REBDEC)VAL_INT64(arg) : VAL_DECIMAL(arg))
+				: get_vect_dec(btype, b, n);
+			switch (action) {
+			case A_ADD:		 x += y; break;
+			case A_SUBTRACT: x -= y; break;
+			case A_MULTIPLY: x *= y; break;
+			case A_DIVIDE:
+				if (y == 0) Trap0(RE_ZERO_DIVIDE);
+				x /= y;
+				break;
+			}
+			if (type >= VTSF08) set_vect(type, dst, n, 0, x);
+			else {
+				if (!(x >= MIN_D64 && x < MAX_D64)) Trap0(RE_OVERFLOW);
+				set_vect(type, dst, n, (REBI64)x, 0);
+			}
+		}
+	}
+	else {
+		REBI64 x, y;
+		for (n = 0; n < len; n++) {
+			x = (REBI64)get_vect(type, a, n);
+			y = scalar ? VAL_INT64(arg) : (REBI64)get_vect(btype, b, n);
+			switch (action) {
+			case A_ADD:		 x = (REBI64)((REBU64)x + (REBU64)y); break;
+			case A_SUBTRACT: x = (REBI64)((REBU64)x - (REBU64)y); break;
+			case A_MULTIPLY: x = (REBI64)((REBU64)x * (REBU64)y); break;
+			case A_DIVIDE:
+				if (y == 0) Trap0(RE_ZERO_DIVIDE);
+				x = VECT_DIV(REBI64, REBU64, 1, x, y);
+				break;
+			}
+			set_vect(type, dst, n, x, 0);
+		}
+	}
+
+	SET_VECTOR(value, ser);
+}
+
 
 void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 {
@@ -181,6 +457,9 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 			set_vect(bits, ser->data, n++, i, f);
 		}
 	}
+	else if (IS_STRING(blk)) {
+		Scan_Vector_Text(blk, ser, 0);
+	}
 	else {
 		REBYTE *data = VAL_BIN_DATA(blk);
 		for (; len > 0; len--, idx++) {
@@ -190,6 +469,89 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 }
 
 
+/***********************************************************************
+**
+*/	REBCNT Scan_Vector_Text(REBVAL *text, REBSER *vect, REBFLG *is_dec)
+/*
+**		Scan a string, or a binary holding text, of numbers separated
+**		by whitespace, commas or semicolons (e.g. a column read from a
+**		CSV file). With vect zero, only counts the numbers and sets
+**		is_dec if any of them is not an integer; otherwise stores
+**		them into vect. Returns the count.
+**
+**		Numbers go through Scan_Integer and Scan_Decimal, so decimals
+**		take the Fast_Strtod path. Traps on a malformed number.
+**
+***********************************************************************/
+{
+	REBSER *ser = VAL_SERIES(text);
+	REBCNT idx = VAL_INDEX(text);
+	REBCNT tail = VAL_TAIL(text);
+	REBCNT bits = vect ? VECT_TYPE(vect) : 0;
+	REBYTE buf[MAX_NUM_LEN+1];
+	REBVAL num;
+	REBCNT n = 0;
+	REBCNT len;
+	REBUNI c;
+	REBI64 i = 0;
+	REBDEC f = 0;
+
+	if (!vect) *is_dec = FALSE;
+
+	while (idx < tail) {
+		c = GET_ANY_CHAR(ser, idx);
+		if (IS_WHITE(c) || c == ',' || c == ';') {
+			idx++;
+			continue;
+		}
+		for (len = 0; idx < tail; idx++, len++) {
+			c = GET_ANY_CHAR(ser, idx);
+			if (IS_WHITE(c) || c == ',' || c == ';') break;
+			if (c > 127 || len >= MAX_NUM_LEN) Trap_Make(REB_VECTOR, text);
+			buf[len] = (REBYTE)c;
+		}
+		buf[len] = 0;
+
+		if (Scan_Integer(buf, len, &num)) {
+			i = VAL_INT64(&num);
+			f = (REBDEC)i;
+		}
+		else if (Scan_Decimal(buf, len, &num, TRUE)) {
+			f = VAL_DECIMAL(&num);
+			if (!vect) *is_dec = TRUE;
+			else if (bits < VTSF08) {
+				if (!(f >= MIN_D64 && f < MAX_D64)) Trap0(RE_OVERFLOW);
+				i = (REBI64)f;
+			}
+		}
+		else Trap_Make(REB_VECTOR, text);
+
+		if (vect) set_vect(bits, vect->data, n, i, f);
+		n++;
+	}
+
+	return n;
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Text_To_Vector(REBVAL *text)
+/*
+**		Convert a text column of numbers to a vector: integer! 64 if
+**		all of them are integers, else decimal! 64.
+**
+***********************************************************************/
+{
+	REBFLG is_dec;
+	REBCNT len = Scan_Vector_Text(text, 0, &is_dec);
+	REBSER *vect = Make_Vector(is_dec, 0, 0, 64, len);
+
+	Scan_Vector_Text(text, vect, 0);
+	return vect;
+}
+
+
 /***********************************************************************
 **
 */	REBSER *Make_Vector_Block(REBVAL *vect)
@@ -302,22 +664,592 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 }
 
 
+// Typed loop bodies for the reductions below (used with VECT_SWITCH):
+#define SUM_INT(T) {T *p = (T*)data; for (n = 0; n < len; n++) sum += p[n];}
+#define SUM_DEC(T) {T *p = (T*)data; \
+	for (; n + 4 <= len; n += 4) {s0 += p[n]; s1 += p[n+1]; s2 += p[n+2]; s3 += p[n+3];} \
+	for (; n < len; n++) s0 += p[n];}
+#define MIN_MAX(T) {T *p = (T*)data; T m = p[0]; \
+	if (maxi) {for (n = 1; n < len; n++) m = (p[n] > m) ? p[n] : m;} \
+	else {for (n = 1; n < len; n++) m = (p[n] < m) ? p[n] : m;} \
+	*(T*)&buf = m;}
+#define DOT_INT(T) {T *p = (T*)d1; T *q = (T*)d2; \
+	for (n = 0; n < len; n++) isum += (REBI64)p[n] * (REBI64)q[n];}
+#define DOT_DEC(T) {T *p = (T*)d1; T *q = (T*)d2; \
+	for (n = 0; n < len; n++) dsum += (REBDEC)p[n] * (REBDEC)q[n];}
+#define MASK(T) {T *ap = (T*)a; T *bp = (T*)b; T k = *bp; \
+	if (scalar) { \
+		if (mode == 0) for (n = 0; n < len; n++) dp[n] = (ap[n] == k); \
+		else if (mode == -1) for (n = 0; n < len; n++) dp[n] = (ap[n] >= k); \
+		else for (n = 0; n < len; n++) dp[n] = (ap[n] > k); \
+	} else { \
+		if (mode == 0) for (n = 0; n < len; n++) dp[n] = (ap[n] == bp[n]); \
+		else if (mode == -1) for (n = 0; n < len; n++) dp[n] = (ap[n] >= bp[n]); \
+		else for (n = 0; n < len; n++) dp[n] = (ap[n] > bp[n]); \
+	}}
+
+
 /***********************************************************************
 **
-*/	REBSER *Make_Vector(REBINT type, REBINT sign, REBINT dims, REBINT bits, REBINT size)
+*/	static REBDEC Sum_Vector_Dec(REBCNT type, REBYTE *data, REBCNT len)
+/*
+**		Sum of any vector type as a decimal. Four partial sums keep
+**		the adds independent so they can be pipelined.
+**
+***********************************************************************/
+{
+	REBDEC s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	REBCNT n = 0;
+
+	VECT_SWITCH(type, SUM_DEC)
+
+	return (s0 + s1) + (s2 + s3);
+}
+
+
+/***********************************************************************
+**
+*/	static void Sum_Elements(REBCNT type, REBYTE *data, REBCNT len, REBVAL *out)
+/*
+**		Sum of vector elements. Integer vectors sum to an integer
+**		(an overflow is an error), others to a decimal.
+**
+***********************************************************************/
+{
+	REBI64 sum = 0;
+	REBU64 u;
+	REBCNT n;
+
+	if (type >= VTSF08) {
+		SET_DECIMAL(out, Sum_Vector_Dec(type, data, len));
+		return;
+	}
+
+	if (type == VTSI64 || type == VTUI64) {
+		for (n = 0; n < len; n++) {
+			u = get_vect(type, data, n);
+			if (type == VTUI64 && u > (REBU64)MAX_I64) Trap0(RE_OVERFLOW);
+			if (REB_I64_ADD_OF(sum, (REBI64)u, &sum)) Trap0(RE_OVERFLOW);
+		}
+	}
+	else {
+		// 32 bits or less can not overflow 64 bits within a series:
+		VECT_SWITCH(type, SUM_INT)
+	}
+
+	SET_INTEGER(out, sum);
+}
+
+
+/***********************************************************************
+**
+*/	void Sum_Vector(REBVAL *vect, REBVAL *out)
+/*
+***********************************************************************/
+{
+	Sum_Elements(VECT_TYPE(VAL_SERIES(vect)), VAL_DATA(vect), VAL_LEN(vect), out);
+}
+
+
+/***********************************************************************
+**
+*/	void Mean_Vector(REBVAL *vect, REBVAL *out)
+/*
+**		Arithmetic mean of the vector elements, or NONE if empty.
+**
+***********************************************************************/
+{
+	REBCNT len = VAL_LEN(vect);
+
+	if (len == 0) {
+		SET_NONE(out);
+		return;
+	}
+	SET_DECIMAL(out, Sum_Vector_Dec(VECT_TYPE(VAL_SERIES(vect)), VAL_DATA(vect), len) / len);
+}
+
+
+/***********************************************************************
+**
+*/	static void Min_Max_Elements(REBCNT type, REBYTE *data, REBCNT len, REBFLG maxi, REBVAL *out)
+/*
+**		Smallest (or largest, if maxi) vector element, or NONE if
+**		there are none.
+**
+***********************************************************************/
+{
+	REBU64 buf = 0;
+	REBCNT n;
+
+	if (len == 0) {
+		SET_NONE(out);
+		return;
+	}
+
+	VECT_SWITCH(type, MIN_MAX)
+
+	if (type == VTUI64 && buf > (REBU64)MAX_I64) Trap0(RE_OVERFLOW);
+	out->data.integer = get_vect(type, (REBYTE*)&buf, 0);
+	VAL_SET(out, (type >= VTSF08) ? REB_DECIMAL : REB_INTEGER);
+}
+
+
+/***********************************************************************
+**
+*/	void Min_Max_Vector(REBVAL *vect, REBFLG maxi, REBVAL *out)
+/*
+***********************************************************************/
+{
+	Min_Max_Elements(VECT_TYPE(VAL_SERIES(vect)), VAL_DATA(vect), VAL_LEN(vect), maxi, out);
+}
+
+
+// Matrix kernels work on square tiles of this many elements a side,
+// so that the rows of both operands stay in cache as a tile is used:
+#define MATRIX_BLOCK 64
+
+#define TRANSPOSE(T) {T *p = (T*)src; T *q = (T*)dst; \
+	for (i0 = 0; i0 < rows; i0 += MATRIX_BLOCK) \
+	for (j0 = 0; j0 < cols; j0 += MATRIX_BLOCK) \
+	for (i = i0; i < rows && i < i0 + MATRIX_BLOCK; i++) \
+	for (j = j0; j < cols && j < j0 + MATRIX_BLOCK; j++) \
+		q[j * rows + i] = p[i * cols + j];}
+
+
+/***********************************************************************
+**
+*/	static void Matrix_Shape(REBVAL *vect, REBCNT *rows, REBCNT *cols)
+/*
+**		Rows and columns of a vector value. A plain vector is a
+**		single row. A matrix must be indexed at the start of a row.
+**
+***********************************************************************/
+{
+	REBCNT c = VECT_COLS(VAL_SERIES(vect));
+	REBCNT len = VAL_LEN(vect);
+
+	if (!c) c = len;
+	else if ((VAL_INDEX(vect) % c) || (len % c)) Trap_Arg(vect);
+
+	*cols = c;
+	*rows = c ? len / c : 0;
+}
+
+
+/***********************************************************************
+**
+*/	void Transpose_Vector(REBVAL *vect, REBVAL *out)
+/*
+**		Transposed copy of a matrix. A plain vector becomes a column.
+**
+***********************************************************************/
+{
+	REBSER *ser;
+	REBYTE *src = VAL_DATA(vect);
+	REBYTE *dst;
+	REBCNT rows, cols;
+	REBCNT i, j, i0, j0;
+
+	Matrix_Shape(vect, &rows, &cols);
+	if (rows > 0xffffff) Trap_Arg(vect);
+
+	ser = Make_Vector_As(VAL_SERIES(vect), VAL_LEN(vect));
+	SET_VECT_COLS(ser, rows);
+	dst = ser->data;
+
+	VECT_SWITCH(VECT_TYPE(ser), TRANSPOSE)
+
+	SET_VECTOR(out, ser);
+}
+
+
+/***********************************************************************
+**
+*/	void Reshape_Vector(REBVAL *vect, REBCNT cols)
+/*
+**		Set the number of columns of a vector (zero for a plain
+**		vector). The data is shared, not copied.
+**
+***********************************************************************/
+{
+	REBSER *ser = VAL_SERIES(vect);
+
+	TRAP_PROTECT(ser);
+	if (cols > 0xffffff || (cols && (VAL_INDEX(vect) % cols || SERIES_TAIL(ser) % cols)))
+		Trap_Arg(vect);
+
+	SET_VECT_COLS(ser, cols);
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Make_Vector_View(REBVAL *vect, REBCNT len)
+/*
+**		A view of part of a vector (see Make_View_Series). A matrix
+**		view keeps its columns if it holds whole rows.
+**
+***********************************************************************/
+{
+	REBCNT cols = VECT_COLS(VAL_SERIES(vect));
+	REBSER *ser = Make_View_Series(VAL_SERIES(vect), VAL_INDEX(vect), len);
+
+	if (cols && ((VAL_INDEX(vect) % cols) || (SERIES_TAIL(ser) % cols)))
+		SET_VECT_COLS(ser, 0);
+
+	return ser;
+}
+
+
+/***********************************************************************
+**
+*/	static REBYTE *Matrix_Data(REBVAL *vect, REBFLG dec)
+/*
+**		Elements of a vector as 64-bit decimals or integers. The
+**		vector data is used as is when it already has that type,
+**		else it is converted to a temporary series.
+**
+***********************************************************************/
+{
+	REBCNT type = VECT_TYPE(VAL_SERIES(vect));
+	REBCNT len = VAL_LEN(vect);
+	REBYTE *data = VAL_DATA(vect);
+	REBSER *ser;
+	REBCNT n;
+
+	if (type == (dec ? VTSF64 : VTSI64)) return data;
+
+	ser = Make_Series(len + 1, 8, FALSE);
+	if (dec) {
+		for (n = 0; n < len; n++) ((REBDEC*)ser->data)[n] = get_vect_dec(type, data, n);
+	}
+	else {
+		for (n = 0; n < len; n++) {
+			((REBU64*)ser->data)[n] = get_vect(type, data, n);
+			if (type == VTUI64 && ((REBU64*)ser->data)[n] > (REBU64)MAX_I64) Trap0(RE_OVERFLOW);
+		}
+	}
+	return ser->data;
+}
+
+
+/***********************************************************************
+**
+*/	static void Matrix_Product(REBVAL *v1, REBVAL *v2, REBVAL *out)
+/*
+**		Matrix product of two vectors. A plain vector is a row on
+**		the left and a column on the right, as in linear algebra,
+**		and the result is then also a plain vector.
+**
+**		The result is decimal if either operand is decimal, else a
+**		64-bit integer (an overflow is an error).
+**
+**		The loops are tiled in MATRIX_BLOCK squares and ordered so
+**		that the innermost one walks rows of both the second operand
+**		and the result, which keeps it sequential in memory.
+**
+***********************************************************************/
+{
+	REBCNT m, kk, nn, rows2;
+	REBCNT i, j, k, i0, j0, k0, i1, j1, k1;
+	REBFLG dec;
+	REBFLG plain;
+	REBSER *ser;
+	REBYTE *a, *b;
+
+	Matrix_Shape(v1, &m, &kk);
+	if (VECT_COLS(VAL_SERIES(v2))) Matrix_Shape(v2, &rows2, &nn);
+	else rows2 = VAL_LEN(v2), nn = 1;
+	if (rows2 != kk) Trap_Arg(v2);
+
+	plain = !VECT_COLS(VAL_SERIES(v1)) || !VECT_COLS(VAL_SERIES(v2));
+	dec = VECT_TYPE(VAL_SERIES(v1)) >= VTSF08 || VECT_TYPE(VAL_SERIES(v2)) >= VTSF08;
+
+	if (!plain && nn > 0xffffff) Trap_Arg(v2);
+	if (nn && m > 0x7fffffff / nn) Trap0(RE_OVERFLOW);
+	ser = Make_Vector(dec, 0, plain ? 0 : nn, 64, m * nn);
+
+	a = Matrix_Data(v1, dec);
+	b = Matrix_Data(v2, dec);
+
+	for (i0 = 0; i0 < m; i0 += MATRIX_BLOCK) {
+		i1 = MIN(m, i0 + MATRIX_BLOCK);
+		for (k0 = 0; k0 < kk; k0 += MATRIX_BLOCK) {
+			k1 = MIN(kk, k0 + MATRIX_BLOCK);
+			for (j0 = 0; j0 < nn; j0 += MATRIX_BLOCK) {
+				j1 = MIN(nn, j0 + MATRIX_BLOCK);
+				for (i = i0; i < i1; i++) {
+					for (k = k0; k < k1; k++) {
+						if (dec) {
+							REBDEC x = ((REBDEC*)a)[i * kk + k];
+							REBDEC *bp = (REBDEC*)b + k * nn;
+							REBDEC *cp = (REBDEC*)ser->data + i * nn;
+							for (j = j0; j < j1; j++) cp[j] += x * bp[j];
+						}
+						else {
+							REBI64 x = ((REBI64*)a)[i * kk + k];
+							REBI64 *bp = (REBI64*)b + k * nn;
+							REBI64 *cp = (REBI64*)ser->data + i * nn;
+							REBI64 p;
+							for (j = j0; j < j1; j++) {
+								if (
+									REB_I64_MUL_OF(x, bp[j], &p)
+									|| REB_I64_ADD_OF(cp[j], p, &cp[j])
+								) Trap0(RE_OVERFLOW);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	SET_VECTOR(out, ser);
+}
+
+
+/***********************************************************************
+**
+*/	void Reduce_Matrix(REBVAL *vect, REBCNT op, REBFLG columns, REBVAL *out)
+/*
+**		Reduce each row (or each column) of a matrix to a vector.
+**		Op is 0 for sum, 1 for mean, 2 for min and 3 for max, with
+**		the result types of the whole-vector reductions. Columns
+**		are reduced a row at a time so the data is read in order.
+**
+***********************************************************************/
+{
+	REBSER *vser = VAL_SERIES(vect);
+	REBCNT type = VECT_TYPE(vser);
+	REBCNT wide = SERIES_WIDE(vser);
+	REBYTE *data = VAL_DATA(vect);
+	REBCNT rows, cols;
+	REBCNT len;
+	REBCNT r, j;
+	REBSER *ser;
+	REBYTE *dp;
+	REBVAL val;
+
+	Matrix_Shape(vect, &rows, &cols);
+	len = columns ? cols : rows;
+
+	if (op >= 2) {
+		ser = Make_Vector_As(vser, len);
+		SET_VECT_COLS(ser, 0);
+	}
+	else ser = Make_Vector(op == 1 || type >= VTSF08, 0, 0, 64, len);
+	dp = ser->data;
+
+	if (!columns) {
+		for (r = 0; r < rows; r++, data += cols * wide) {
+			if (op == 0) Sum_Elements(type, data, cols, &val);
+			else if (op == 1) SET_DECIMAL(&val, Sum_Vector_Dec(type, data, cols) / cols);
+			else Min_Max_Elements(type, data, cols, op == 3, &val);
+			if (IS_DECIMAL(&val) && VECT_TYPE(ser) >= VTSF08)
+				set_vect(VECT_TYPE(ser), dp, r, 0, VAL_DECIMAL(&val));
+			else
+				set_vect(VECT_TYPE(ser), dp, r, VAL_INT64(&val), 0);
+		}
+	}
+	else if (op >= 2) {
+		if (rows == 0) {
+			SET_NONE(out);
+			return;
+		}
+		COPY_MEM(dp, data, cols * wide);
+		for (r = 1; r < rows; r++) {
+			data += cols * wide;
+			for (j = 0; j < cols; j++) {
+				REBINT cmp;
+				if (type >= VTSF08) {
+					REBDEC x = get_vect_dec(type, data, j), y = get_vect_dec(type, dp, j);
+					cmp = (x > y) - (x < y);
+				}
+				else if (type >= VTUI08) {
+					REBU64 x = get_vect(type, data, j), y = get_vect(type, dp, j);
+					cmp = (x > y) - (x < y);
+				}
+				else {
+					REBI64 x = get_vect(type, data, j), y = get_vect(type, dp, j);
+					cmp = (x > y) - (x < y);
+				}
+				if (op == 3 ? cmp > 0 : cmp < 0)
+					COPY_MEM(dp + j * wide, data + j * wide, wide);
+			}
+		}
+	}
+	else if (VECT_TYPE(ser) >= VTSF08) {
+		if (op == 1 && rows == 0) {
+			SET_NONE(out);
+			return;
+		}
+		for (r = 0; r < rows; r++, data += cols * wide)
+			for (j = 0; j < cols; j++) ((REBDEC*)dp)[j] += get_vect_dec(type, data, j);
+		if (op == 1) for (j = 0; j < cols; j++) ((REBDEC*)dp)[j] /= rows;
+	}
+	else {
+		for (r = 0; r < rows; r++, data += cols * wide) {
+			for (j = 0; j < cols; j++) {
+				REBU64 u = get_vect(type, data, j);
+				if (type == VTUI64 && u > (REBU64)MAX_I64) Trap0(RE_OVERFLOW);
+				if (REB_I64_ADD_OF(((REBI64*)dp)[j], (REBI64)u, &((REBI64*)dp)[j])) Trap0(RE_OVERFLOW);
+			}
+		}
+	}
+
+	SET_VECTOR(out, ser);
+}
+
+
+/***********************************************************************
+**
+*/	void Dot_Vector(REBVAL *v1, REBVAL *v2, REBVAL *out)
+/*
+**		Dot product of two vectors of the same length. It is a
+**		decimal if either vector is decimal, else an integer (an
+**		overflow is an error). If either vector is a matrix, it is
+**		the matrix product instead.
+**
+***********************************************************************/
+{
+	REBCNT t1 = VECT_TYPE(VAL_SERIES(v1));
+	REBCNT t2 = VECT_TYPE(VAL_SERIES(v2));
+	REBCNT len = VAL_LEN(v1);
+	REBYTE *d1 = VAL_DATA(v1);
+	REBYTE *d2 = VAL_DATA(v2);
+	REBDEC dsum = 0;
+	REBI64 isum = 0;
+	REBI64 p;
+	REBCNT n;
+
+	if (VECT_COLS(VAL_SERIES(v1)) || VECT_COLS(VAL_SERIES(v2))) {
+		Matrix_Product(v1, v2, out);
+		return;
+	}
+
+	if (VAL_LEN(v2) != len) Trap_Arg(v2);
+
+	if (t1 >= VTSF08 || t2 >= VTSF08) {
+		if (t1 == t2) {
+			VECT_SWITCH(t1, DOT_DEC)
+		}
+		else {
+			for (n = 0; n < len; n++)
+				dsum += get_vect_dec(t1, d1, n) * get_vect_dec(t2, d2, n);
+		}
+		SET_DECIMAL(out, dsum);
+		return;
+	}
+
+	if (t1 == t2 && (t1 & 3) < 2) {
+		// 8 and 16 bit products can not overflow the 64 bit sum:
+		VECT_SWITCH(t1, DOT_INT)
+	}
+	else {
+		REBU64 x, y;
+		for (n = 0; n < len; n++) {
+			x = get_vect(t1, d1, n);
+			y = get_vect(t2, d2, n);
+			if (
+				(t1 == VTUI64 && x > (REBU64)MAX_I64)
+				|| (t2 == VTUI64 && y > (REBU64)MAX_I64)
+				|| REB_I64_MUL_OF((REBI64)x, (REBI64)y, &p)
+				|| REB_I64_ADD_OF(isum, p, &isum)
+			) Trap0(RE_OVERFLOW);
+		}
+	}
+
+	SET_INTEGER(out, isum);
+}
+
+
+/***********************************************************************
+**
+*/	void Mask_Vector(REBVAL *vect, REBVAL *arg, REBINT mode, REBFLG invert, REBVAL *out)
+/*
+**		Compare each element with the same element of another vector
+**		or with a number, giving an unsigned 8-bit vector of 1 where
+**		the comparison holds and 0 where it does not.
+**
+**		Mode follows Compare_Values: 0 is equal, -1 greater or equal,
+**		-2 greater. Invert gives not-equal, lesser, lesser or equal.
+**
+***********************************************************************/
+{
+	REBCNT type = VECT_TYPE(VAL_SERIES(vect));
+	REBCNT len = VAL_LEN(vect);
+	REBYTE *a = VAL_DATA(vect);
+	REBYTE *b;
+	REBCNT btype;
+	REBFLG scalar;
+	REBFLG fast;
+	REBU64 buf;
+	REBSER *ser;
+	REBYTE *dp;
+	REBCNT n;
+
+	if (IS_VECTOR(arg)) {
+		if (VAL_LEN(arg) != len) Trap_Arg(arg);
+		b = VAL_DATA(arg);
+		btype = VECT_TYPE(VAL_SERIES(arg));
+		scalar = FALSE;
+		fast = (btype == type);
+	}
+	else {
+		b = (REBYTE*)&buf;
+		btype = IS_INTEGER(arg) ? VTSI64 : VTSF64;
+		scalar = TRUE;
+		fast = Vect_Scalar(type, arg, b);
+	}
+
+	ser = Make_Vector(0, 1, 0, 8, len);
+	if (VECT_COLS(VAL_SERIES(vect)) && !(len % VECT_COLS(VAL_SERIES(vect))))
+		SET_VECT_COLS(ser, VECT_COLS(VAL_SERIES(vect)));
+	dp = BIN_HEAD(ser);
+
+	if (fast) {
+		VECT_SWITCH(type, MASK)
+	}
+	else if (type >= VTSF08 || btype >= VTSF08) {
+		REBDEC x, y;
+		for (n = 0; n < len; n++) {
+			x = get_vect_dec(type, a, n);
+			y = scalar ? (IS_INTEGER(arg) ? (REBDEC)VAL_INT64(arg) : VAL_DECIMAL(arg))
+				: get_vect_dec(btype, b, n);
+			dp[n] = (mode == 0) ? (x == y) : (mode == -1) ? (x >= y) : (x > y);
+		}
+	}
+	else {
+		REBI64 x, y;
+		for (n = 0; n < len; n++) {
+			x = (REBI64)get_vect(type, a, n);
+			y = scalar ? VAL_INT64(arg) : (REBI64)get_vect(btype, b, n);
+			dp[n] = (mode == 0) ? (x == y) : (mode == -1) ? (x >= y) : (x > y);
+		}
+	}
+
+	if (invert) for (n = 0; n < len; n++) dp[n] ^= 1;
+
+	SET_VECTOR(out, ser);
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Make_Vector(REBINT type, REBINT sign, REBINT cols, REBINT bits, REBINT size)
 /*
 **		type: the datatype
 **		sign: signed or unsigned
-**		dims: number of dimensions
+**		cols: columns of a matrix (0 for a plain vector)
 **		bits: number of bits per unit (8, 16, 32, 64)
-**		size: size of array ?
+**		size: total number of units
 **
 ***********************************************************************/
 {
 	REBCNT len;
 	REBSER *ser;
 
-	len = size * dims;
+	len = size;
 	if (len > 0x7fffffff) return 0;
 	ser = Make_Series(len+1, bits/8, TRUE); // !!! can width help extend the len?
 	LABEL_SERIES(ser, "make vector");
@@ -331,7 +1263,7 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 	case 32: bits = 2; break;
 	case 64: bits = 3; break;
 	}
-	ser->size = (dims << 8) | (type << 3) | (sign << 2) | bits;
+	ser->size = (cols << 8) | (type << 3) | (sign << 2) | bits;
 
 	return ser;
 }
@@ -345,19 +1277,19 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 **     make vector! [integer! 32 100]
 **     make vector! [decimal! 64 100]
 **     make vector! [unsigned integer! 32]
+**     make vector! [decimal! 64 3x2]  ; matrix of 3 columns, 2 rows
 **     Fields:
 **          signed:     signed, unsigned
 **    		datatypes:  integer, decimal
-**    		dimensions: 1 - N
 **    		bitsize:    1, 8, 16, 32, 64
-**    		size:       integer units
-**    		init:		block of values
+**    		size:       integer units, or pair for columns x rows
+**    		init:		block of values, or string of numbers
 **
 ***********************************************************************/
 {
 	REBINT type = -1; // 0 = int,    1 = float
 	REBINT sign = -1; // 0 = signed, 1 = unsigned
-	REBINT dims = 1;
+	REBINT cols = 0;
 	REBINT bits = 32;
 	REBCNT size = 1;
 	REBSER *vect;
@@ -401,12 +1333,23 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 		if (size < 0) return 0;
 		bp++;
 	}
+	else if (IS_PAIR(bp)) {
+		REBINT rows = VAL_PAIR_Y_INT(bp);
+		cols = VAL_PAIR_X_INT(bp);
+		if (cols <= 0 || rows <= 0 || cols > 0xffffff || rows > 0x7fffffff / cols) return 0;
+		size = cols * rows;
+		bp++;
+	}
 
 	// Initial data:
-	if (IS_BLOCK(bp) || IS_BINARY(bp)) {
-		REBCNT len = VAL_LEN(bp);
+	if (IS_BLOCK(bp) || IS_BINARY(bp) || IS_STRING(bp)) {
+		REBFLG is_dec;
+		REBCNT len = IS_STRING(bp) ? Scan_Vector_Text(bp, 0, &is_dec) : VAL_LEN(bp);
 		if (IS_BINARY(bp) && type == 1) return 0;
-		if (len > size) size = len;
+		if (len > size) {
+			if (cols) return 0;
+			size = len;
+		}
 		iblk = bp;
 		bp++;
 	}
@@ -420,7 +1363,7 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 
 	if (NOT_END(bp)) return 0;
 
-	vect = Make_Vector(type, sign, dims, bits, size);
+	vect = Make_Vector(type, sign, cols, bits, size);
 	if (!vect) return 0;
 
 	if (iblk) Set_Vector_Row(vect, iblk);
@@ -465,9 +1408,9 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 /*
 ***********************************************************************/
 {
-	REBSER *vect;
+	REBSER *vect = VAL_SERIES(pvs->value);
 	REBINT n;
-	REBINT dims;
+	REBINT cols = VECT_COLS(vect);
 	REBINT bits;
 	REBYTE *vp;
 	REBI64 i;
@@ -475,13 +1418,17 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 
 	if (IS_INTEGER(pvs->select) || IS_DECIMAL(pvs->select))
 		n = Int32(pvs->select);
+	else if (IS_PAIR(pvs->select) && cols) {
+		// Matrix element as column x row:
+		REBINT x = VAL_PAIR_X_INT(pvs->select);
+		if (x <= 0 || x > cols) return pvs->setval ? PE_BAD_RANGE : PE_NONE;
+		n = (VAL_PAIR_Y_INT(pvs->select) - 1) * cols + x;
+	}
 	else return PE_BAD_SELECT;
 
 	n += VAL_INDEX(pvs->value);
-	vect = VAL_SERIES(pvs->value);
 	vp   = vect->data;
 	bits = VECT_TYPE(vect);
-	dims = vect->size >> 8;
 
 	if (pvs->setval == 0) {
 
@@ -533,8 +1480,21 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 	REBSER *vect;
 	REBSER *ser;
 
+	// Element-wise math (before the generic series actions trap it):
+	if (action >= A_ADD && action <= A_DIVIDE) {
+		Math_Vector(value, arg, action);
+		*D_RET = *value;
+		return R_RET;
+	}
+
 	type = Do_Series_Action(action, value, arg);
-	if (type >= 0) return type;
+	if (type >= 0) {
+		// A matrix that lost part of a row is no longer one:
+		vect = VAL_SERIES(value);
+		if (action == A_REMOVE && VECT_COLS(vect) && (vect->tail % VECT_COLS(vect)))
+			SET_VECT_COLS(vect, 0);
+		return type;
+	}
 
 	vect = VAL_SERIES(value); // not valid for MAKE or TO
 
@@ -560,12 +1520,12 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 		if (IS_INTEGER(arg) || IS_DECIMAL(arg)) {
 			size = Int32s(arg, 0);
 			if (size < 0) goto bad_make;
-			ser = Make_Vector(0, 0, 1, 32, size);
+			ser = Make_Vector(0, 0, 0, 32, size);
 			SET_VECTOR(value, ser);
 			break;
 		}
 //		if (IS_NONE(arg)) {
-//			ser = Make_Vector(0, 0, 1, 32, 0);
+//			ser = Make_Vector(0, 0, 0, 32, 0);
 //			SET_VECTOR(value, ser);
 //			break;
 //		}
@@ -574,6 +1534,12 @@ void Set_Vector_Row(REBSER *ser, REBVAL *blk)
 	case A_TO:
 		// CASE: make vector! [...]
 		if (IS_BLOCK(arg) && Make_Vector_Spec(VAL_BLK_DATA(arg), value)) break;
+		// CASE: to vector! "1 2.5 3" (or the same text as binary)
+		if (IS_STRING(arg) || IS_BINARY(arg)) {
+			ser = Text_To_Vector(arg);
+			SET_VECTOR(value, ser);
+			break;
+		}
 		goto bad_make;
 
 	case A_LENGTHQ:
@@ -614,7 +1580,7 @@ bad_make:
 	REBSER *vect = VAL_SERIES(value);
 	REBYTE *data = vect->data;
 	REBCNT bits  = VECT_TYPE(vect);
-//	REBCNT dims  = vect->size >> 8;
+	REBCNT cols  = VECT_COLS(vect);
 	REBCNT len;
 	REBCNT n;
 	REBCNT c;
@@ -630,12 +1596,16 @@ bad_make:
 		n = VAL_INDEX(value);
 	}
 
+	// A matrix molds by rows, unless it is not at a row boundary:
+	if (cols && ((n % cols) || (len % cols))) cols = 0;
+
 	if (molded) {
 		REBCNT type = (bits >= VTSF08) ? REB_DECIMAL : REB_INTEGER;
 		Pre_Mold(value, mold);
 		if (!GET_MOPT(mold, MOPT_MOLD_ALL)) Append_Byte(mold->series, '[');
 		if (bits >= VTUI08 && bits <= VTUI64) Append_Bytes(mold->series, "unsigned ");
-		Emit(mold, "N I I [", type+1, bit_sizes[bits & 3], len);
+		if (cols) Emit(mold, "N I IxI [", type+1, bit_sizes[bits & 3], cols, len / cols);
+		else Emit(mold, "N I I [", type+1, bit_sizes[bits & 3], len);
 		if (len) New_Indented_Line(mold);
 	}
 
@@ -649,7 +1619,7 @@ bad_make:
 		}
 		Append_Bytes_Len(mold->series, buf, l);
 
-		if ((++c > 7) && (n+1 < vect->tail)) {
+		if ((cols ? (++c == cols) : (++c > 7)) && (n+1 < vect->tail)) {
 			New_Indented_Line(mold);
 			c = 0;
 		}
@@ -51,8 +51,8 @@ enum {
 	RDIA_ALL,			// all commands, do not reset output
 };
 
-static REBINT Delect_Debug = 0;
-static REBINT Total_Missed = 0;
+static INSTANCE REBINT Delect_Debug = 0;
+static INSTANCE REBINT Total_Missed = 0;
 static char *Dia_Fmt = "DELECT - cmd: %s length: %d missed: %d total: %d";
 
 
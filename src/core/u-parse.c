@@ -669,7 +669,7 @@ bad_target:
 
 		//Print_Parse_Index(parse->type, rules, series, index);
 
-		if (--Eval_Count <= 0 || Eval_Signals) Do_Signals();
+		POLL_SIGNALS();
 
 		//--------------------------------------------------------------------
 		// Pre-Rule Processing Section
@@ -1119,7 +1119,7 @@ bad_end:
 
 	while (index < tail) {
 
-		if (--Eval_Count <= 0 || Eval_Signals) Do_Signals();
+		POLL_SIGNALS();
 
 		// Skip whitespace if not /all refinement: 
 		if (skip_spaces) {
@@ -63,19 +63,19 @@ static unsigned char adam7voff[]={0,0,4,0,2,0,1};
 static unsigned char adam7vskip[]={8,8,8,4,4,2,2};
 static unsigned char bytetab2[]={0x00,0x55,0xaa,0xff};
 
-static int log2bitdepth;
-static char haspalette;
-static int bytesperpixel;
-static int bitsperpixel;
-static int rowlength;
-static char hasalpha;
-static unsigned char *imgbuffer;
-static unsigned int palette[256];
-static unsigned short palette_alpha[256];
-static unsigned int *img_output;
-static unsigned int transparent_red,transparent_green,transparent_blue;
-static unsigned int transparent_gray;
-static void (*process_row)(unsigned char *p,int width,int r,int hoff,int hskip);
+static INSTANCE int log2bitdepth;
+static INSTANCE char haspalette;
+static INSTANCE int bytesperpixel;
+static INSTANCE int bitsperpixel;
+static INSTANCE int rowlength;
+static INSTANCE char hasalpha;
+static INSTANCE unsigned char *imgbuffer;
+static INSTANCE unsigned int palette[256];
+static INSTANCE unsigned short palette_alpha[256];
+static INSTANCE unsigned int *img_output;
+static INSTANCE unsigned int transparent_red,transparent_green,transparent_blue;
+static INSTANCE unsigned int transparent_gray;
+static INSTANCE void (*process_row)(unsigned char *p,int width,int r,int hoff,int hskip);
 
 static void process_row_0_1(unsigned char *p,int width,int r,int hoff,int hskip);
 static void process_row_0_2(unsigned char *p,int width,int r,int hoff,int hskip);
@@ -103,7 +103,7 @@ static void *process_row6[]={0,0,0,(void *)process_row_6_8,(void *)process_row_6
 
 static void **process_row_lookup[]={process_row0,0,process_row2,process_row3,process_row4,0,process_row6};
 
-jmp_buf png_state;
+INSTANCE jmp_buf png_state;
 
 static void trap_png(void)
 {
@@ -236,9 +236,29 @@ These are now obsolete (as of A107) and should be removed:
 
 #ifdef TO_LINUX
 #define HAS_POSIX_SIGNAL
+#define HAS_POSIX_PROCESS
 #define HAS_MSG_NOSIGNAL
 #endif
 
+//* Instances **********************************************************
+
+// INSTANCES builds the core with one interpreter per OS thread. The
+// process globals (PVAR), thread globals (TVAR) and module statics
+// marked INSTANCE all become thread-local, so every thread that calls
+// RL_Init owns a separate interpreter and RL_Destroy frees it.
+
+#ifdef INSTANCES
+#undef THREAD
+#ifdef _MSC_VER
+#define THREAD __declspec(thread)
+#else
+#define THREAD __thread
+#endif
+#define INSTANCE THREAD
+#else
+#define INSTANCE
+#endif
+
 //* Defaults ***********************************************************
 
 #ifndef THREAD
@@ -45,6 +45,9 @@ enum {
 	RDI_SERIAL,
 #ifdef HAS_POSIX_SIGNAL
 	RDI_SIGNAL,
+#endif
+#ifdef HAS_POSIX_PROCESS
+	RDI_PROCESS,
 #endif
 	RDI_MAX,
 	RDI_LIMIT = 32
@@ -130,6 +133,12 @@ enum {
 	SERIAL_FLOW_CONTROL_SOFTWARE
 };
 
+// Process Modes (bitnums):
+enum {
+	RPM_SHELL,		// run the command from the shell
+	RPM_MERGE,		// merge stderr into the output
+};
+
 #pragma pack(4)
 
 // Forward references:
@@ -176,6 +185,7 @@ struct rebol_devreq {
 	u16  flags;				// request flags
 	u16  state;				// device process flags
 	i32  timeout;			// request timeout
+	void *timer;			// timer wheel entry (REBOL core)
 //	int (*prewake)(void *);	// callback before awake
 
 	// Common fields:
@@ -193,6 +203,12 @@ struct rebol_devreq {
 			sigset_t mask; 		// signal mask
 		} signal;
 #endif
+		struct {
+			REBYTE *output;			// output read from the process
+			u32  count;				// output bytes not yet taken
+			i32  pid;				// process id
+			i32  exit_code;			// exit code (-1 while running)
+		} process;
 		struct {
 			REBCHR *path;			// file string (in OS local format)
 			i64  size;				// file size
@@ -204,7 +220,9 @@ struct rebol_devreq {
 			u32  local_port;		// local port used
 			u32  remote_ip;			// remote address
 			u32  remote_port;		// remote port
-			void *host_info;		// for DNS usage
+			void *host_info;		// for DNS usage (then connect attempts)
+			u8   local_ip6[16];		// local IPv6 address (RST_IPV6)
+			u8   remote_ip6[16];	// remote IPv6 address (RST_IPV6)
 		} net;
 		struct {
 			REBCHR *path;			//device path string (in OS local format)
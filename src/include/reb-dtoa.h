@@ -138,6 +138,12 @@
  *	pointers, PRIVATE_MEM >= 7400 appears to suffice; with 4-byte
  *	pointers, PRIVATE_MEM >= 7112 appears adequate. */
 
+/* The private pool is a static initialized with its own address, which
+ * cannot be thread-local, so INSTANCES builds use MALLOC instead. */
+#ifdef INSTANCES
+#define Omit_Private_Memory
+#endif
+
 /* #define NO_INFNAN_CHECK if you do not wish to have INFNAN_CHECK
  *	#defined automatically on IEEE systems.  On such systems,
  *	when INFNAN_CHECK is #defined, strtod checks
@@ -77,6 +77,12 @@ typedef struct rxi_cmd_frame {
 	RXIARG args[8];	// arg values (64 bits each)
 } RXIFRM;
 
+// Commands can have up to RXI_MAX_ARGS args. Their frames can be longer
+// than RXIFRM, and the types of all args are also kept in the bytes
+// after the last arg (see RXA_XTYPE), as the [0] arg only has room for 7:
+#define RXI_MAX_ARGS		255
+#define RXI_FRAME_ARGS(n)	((n) + 2 + (n) / 8)	// RXIARGs for n args and their types
+
 typedef struct rxi_cmd_context {
 	void *envr;		// for holding a reference to your environment
 	REBSER *block;	// block being evaluated
@@ -91,6 +97,8 @@ typedef int (*RXICAL)(int cmd, RXIFRM *args, REBCEC *ctx);
 #define RXA_ARG(f,n)	((f)->args[n])
 #define RXA_COUNT(f)	(RXA_ARG(f,0).bytes[0]) // number of args
 #define RXA_TYPE(f,n)	(RXA_ARG(f,0).bytes[n]) // types (of first 7 args)
+#define RXA_XTYPES(f)	((REBYTE *)&RXA_ARG(f, RXA_COUNT(f) + 1)) // types of all args
+#define RXA_XTYPE(f,n)	(RXA_XTYPES(f)[n]) // type of any arg (set it for results of 8+ values)
 #define RXA_REF(f,n)	(RXA_ARG(f,n).int32a)
 
 #define RXA_INT64(f,n)	(RXA_ARG(f,n).int64)
@@ -106,6 +114,7 @@ typedef int (*RXICAL)(int cmd, RXIFRM *args, REBCEC *ctx);
 #define RXA_TUPLE(f,n)	(RXA_ARG(f,n).bytes)
 #define RXA_SERIES(f,n)	(RXA_ARG(f,n).series)
 #define RXA_INDEX(f,n)	(RXA_ARG(f,n).index)
+#define RXA_DATA(f,n)	RL_SERIES_DATA(RXA_SERIES(f,n), RXA_INDEX(f,n), 0) // no copy
 #define RXA_OBJECT(f,n)	(RXA_ARG(f,n).addr)
 #define RXA_MODULE(f,n)	(RXA_ARG(f,n).addr)
 #define RXA_HANDLE(f,n)	(RXA_ARG(f,n).addr)
@@ -138,6 +147,21 @@ enum {
 	RXI_SER_SIZE,	// size of series (in units)
 	RXI_SER_WIDE,	// width of series (in bytes)
 	RXI_SER_LEFT,	// units free in series (past tail)
+	RXI_SER_TYPE,	// number type of vector (see RXI_VEC)
+};
+
+// Vector number types (for RXI_SER_TYPE):
+enum {
+	RXI_VEC_I8,
+	RXI_VEC_I16,
+	RXI_VEC_I32,
+	RXI_VEC_I64,
+	RXI_VEC_U8,
+	RXI_VEC_U16,
+	RXI_VEC_U32,
+	RXI_VEC_U64,
+	RXI_VEC_F32 = 10,
+	RXI_VEC_F64,
 };
 
 // Error Codes (returned in result value from some API functions):
@@ -31,6 +31,7 @@ enum socket_types {
 	RST_UDP,					// TCP or UDP
 	RST_LISTEN = 8,				// LISTEN
 	RST_REVERSE,				// DNS reverse
+	RST_IPV6,					// IPv6 socket (addresses in *_ip6)
 };
 
 // REBOL Socket Modes (state flags)
@@ -43,6 +44,22 @@ enum {
 	RSM_SEND,					// sending
 	RSM_RECEIVE,				// receiving
 	RSM_ACCEPT,					// an inbound connection
+	RSM_LOOKUP,					// resolving the host name
 };
 
 #define IPA(a,b,c,d) (a<<24 | b<<16 | c<<8 | d)
+
+// DNS lookup results (host_info of a completed DNS request):
+#define MAX_DNS_ADDRS	8
+
+typedef struct rebol_dns_addr {
+	u32 family;					// 4 or 6 (IP version)
+	u8  addr[16];				// address in network byte order
+} REBDNSA;
+
+typedef struct rebol_dns_result {
+	u32 count;					// number of addresses (IPv4 first)
+	u32 ttl;					// seconds the result remains valid
+	REBDNSA addrs[MAX_DNS_ADDRS];
+	char name[256];				// host name (for reverse lookups)
+} REBDNS;
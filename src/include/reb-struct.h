@@ -72,15 +72,18 @@ struct Struct_Data {
 	REBCNT offset;
 	REBCNT len;
 	REBFLG flags;
+	REBCNT count; /* elements of a struct array, 0 for a single struct */
 };
 
 #define STRUCT_DATA_BIN(v) (((struct Struct_Data*)SERIES_DATA((v)->data))->data)
 #define STRUCT_OFFSET(v) (((struct Struct_Data*)SERIES_DATA((v)->data))->offset)
 #define STRUCT_LEN(v) (((struct Struct_Data*)SERIES_DATA((v)->data))->len)
 #define STRUCT_FLAGS(v) (((struct Struct_Data*)SERIES_DATA((v)->data))->flags)
+#define STRUCT_COUNT(v) (((struct Struct_Data*)SERIES_DATA((v)->data))->count)
 
 #define VAL_STRUCT_DATA_BIN(v) (((struct Struct_Data*)SERIES_DATA(VAL_STRUCT_DATA(v)))->data)
 #define VAL_STRUCT_OFFSET(v) (((struct Struct_Data*)SERIES_DATA(VAL_STRUCT_DATA(v)))->offset)
 #define VAL_STRUCT_LEN(v) (((struct Struct_Data*)SERIES_DATA(VAL_STRUCT_DATA(v)))->len)
 #define VAL_STRUCT_FLAGS(v) (((struct Struct_Data*)SERIES_DATA(VAL_STRUCT_DATA(v)))->flags)
+#define VAL_STRUCT_COUNT(v) (((struct Struct_Data*)SERIES_DATA(VAL_STRUCT_DATA(v)))->count)
 #define VAL_STRUCT_LIMIT	MAX_U32
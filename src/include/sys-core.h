@@ -54,6 +54,7 @@
 #include <stdarg.h>		// For var-arg Print functions
 #include <string.h>
 #include <setjmp.h>
+#include <signal.h>		// For sig_atomic_t
 #include <math.h>
 
 // Special OS-specific definitions:
@@ -219,6 +220,15 @@ enum Reb_Reflectors {
 	OF_TITLE,
 };
 
+// Aggregates of Group_Table (group-by):
+enum {
+	AGG_SUM,
+	AGG_MEAN,
+	AGG_MIN,
+	AGG_MAX,
+	AGG_COUNT
+};
+
 // Load option flags:
 enum {
 	LOAD_ALL = 0,		// Returns header along with script if present
@@ -323,7 +333,11 @@ void Crash(REBINT id, ...);
 #define IS_WHITE(c) ((c) <= 32 && (White_Chars[c]&1) != 0)
 #define IS_SPACE(c) ((c) <= 32 && (White_Chars[c]&2) != 0)
 
-#define SET_SIGNAL(f) SET_FLAG(Eval_Signals, f)
+// Setting a signal ends the evaluation dose (keeping the cycle total),
+// so the evaluator only has to poll Eval_Count. See POLL_SIGNALS.
+// Not for signal handlers: they set Eval_Escape (see RL_Escape).
+#define SET_SIGNAL(f) (SET_FLAG(Eval_Signals, f), Eval_Cycles -= Eval_Count - 1, Eval_Count = 1)
+#define POLL_SIGNALS() if (--Eval_Count <= 0) Do_Signals()
 #define GET_SIGNAL(f) GET_FLAG(Eval_Signals, f)
 #define CLR_SIGNAL(f) CLR_FLAG(Eval_Signals, f)
 
@@ -446,7 +460,7 @@ extern const REBACT Value_Dispatch[];
 **
 ***********************************************************************/
 
-#define PVAR extern
+#define PVAR extern INSTANCE
 #define TVAR extern THREAD
 
 #include "sys-globals.h"
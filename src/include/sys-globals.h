@@ -60,7 +60,10 @@ PVAR REB_OPTS *Reb_Opts;
 
 // This signal word should be thread-local, but it will not work
 // when implemented that way. Needs research!!!!
+// (With INSTANCES it is per interpreter, so RL_Escape must be
+// called on the thread that owns the interpreter.)
 PVAR REBCNT	Eval_Signals;	// Signal flags
+PVAR volatile sig_atomic_t Eval_Escape; // Escape from a signal handler
 
 
 
@@ -80,6 +83,8 @@ TVAR REBINT	GC_Ballast;		// Bytes allocated to force automatic GC
 TVAR REBOOL	GC_Active;		// TRUE when recycle is enabled (set by RECYCLE func)
 TVAR REBSER	*GC_Protect;	// A stack of protected series (removed by pop)
 TVAR REBSER	*GC_Series;		// An array of protected series (removed by address)
+TVAR REBSER	*GC_Views;		// Pairs of view series and the series they view
+TVAR REBSER	*GC_Unshared;	// Copies of closure body literals made per call
 TVAR REBSER	**GC_Infants;	// A small list of last N series created (nursery)
 TVAR REBINT	GC_Last_Infant;	// Index to last infant above (circular)
 TVAR REBFLG GC_Stay_Dirty;  // Do not free memory, fill it with 0xBB
@@ -95,6 +100,7 @@ TVAR REBINT	DSF;			// Data stack frame (function base)
 TVAR REBSER	*AS_Series;		// Auxiliary series
 
 TVAR jmp_buf *Saved_State;	// Pointer to saved CPU state
+TVAR REBFLG Discard_Errors;	// Saved_State catcher ignores error details
 
 //-- Evaluation variables:
 TVAR REBI64	Eval_Cycles;	// Total evaluation counter (upward)
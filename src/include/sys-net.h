@@ -59,6 +59,8 @@ typedef long __LONG;
 #include <netinet/in.h>
 #include <unistd.h>
 
+#define HAS_IPV6
+
 #define GET_ERROR		errno
 #define IOCTL			ioctl
 #define CLOSE_SOCKET	close
@@ -90,6 +92,11 @@ typedef struct hostent HOSTENT;
 #endif // BSD
 
 typedef struct sockaddr_in SOCKAI; // Internet extensions
+#ifdef HAS_IPV6
+typedef struct sockaddr_storage SOCKAS; // any address family
+#else
+typedef struct sockaddr_in SOCKAS;
+#endif
 
 #define BAD_SOCKET (~0)
 #define MAX_TRANSFER 32000		// Max send/recv buffer size
@@ -77,6 +77,8 @@
 #define DSF_WORD(d)		(&DS_Base[(d)+2])	// func word backtrace
 #define DSF_FUNC(d)		(&DS_Base[(d)+3])	// function value saved
 #define DSF_ARGS(d,n)	(&DS_Base[(d)+DSF_SIZE+(n)])
+// Value of a relative word (a closure keeps its args in the frame object returned):
+#define DSF_VAR(d,n)	(IS_CLOSURE(DSF_FUNC(d)) ? FRM_VALUES(VAL_OBJ_FRAME(DSF_RETURN(d)))+(n) : DSF_ARGS(d,n))
 #define PRIOR_DSF(d)	VAL_BACK(DSF_BACK(d))
 
 // Reference from ds that points to current return value:
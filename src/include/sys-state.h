@@ -35,6 +35,7 @@ typedef struct {		// State variables to save
 	REBINT	dsf;
 	REBINT	hold_tail;	// Tail for GC_Protect
 	REBINT	asp;	// Auxiliary Stack Pointer
+	REBFLG	discard;	// Prior Discard_Errors setting
 } REBOL_STATE;
 
 // Save current state info into a structure:
@@ -46,6 +47,8 @@ typedef struct {		// State variables to save
 		(s).asp = SERIES_TAIL(AS_Series);\
 		(s).hold_tail = GC_Protect->tail;\
 		(s).error = 0;\
+		(s).discard = Discard_Errors;\
+		Discard_Errors = FALSE;\
 	} while(0)
 
 #define POP_STATE(s, g) do {\
@@ -54,6 +57,7 @@ typedef struct {		// State variables to save
 		DSF = (s).dsf;\
 		SERIES_TAIL(AS_Series) = (s).asp;\
 		GC_Protect->tail = (s).hold_tail;\
+		Discard_Errors = (s).discard;\
 	} while (0)
 
 // Do not restore prior state:
@@ -62,9 +66,11 @@ typedef struct {		// State variables to save
 // Set the pointer for the prior state:
 #define	SET_STATE(s, g) g = &(s).cpu_state
 
-// Store all CPU registers into the structure:
+// Store all CPU registers into the structure. The signal mask is not
+// saved: signal handlers only set flags and never jump, so restoring it
+// is not needed, and saving it costs a system call per TRY or PARSE.
 #ifdef HAS_POSIX_SIGNAL
-#define	SET_JUMP(s) sigsetjmp((s).cpu_state, 1)
+#define	SET_JUMP(s) sigsetjmp((s).cpu_state, 0)
 #define	LONG_JUMP(s, v) siglongjmp((s), (v))
 #else
 #define	SET_JUMP(s) setjmp((s).cpu_state)
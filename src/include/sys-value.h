@@ -76,6 +76,8 @@ enum {
 	OPTS_UNWORD,	// Not a normal word
 	OPTS_TEMP,		// Temporary flag - variety of uses
 	OPTS_HIDE,		// Hide the word
+	OPTS_SHARED,	// Literal of a closure body (or native arg that may get one)
+	OPTS_PROTO,		// Object value still shared with its prototype
 };
 
 #define VAL_OPTS(v)			((v)->flags.flags.opts)
@@ -720,6 +722,10 @@ typedef struct Reb_Word {
 	REBCNT	sym;		// Index of the word's symbol
 	REBINT	index;		// Index of the word in the frame
 	REBSER	*frame;		// Frame in which the word is defined
+#if defined(__LP64__) || defined(__LLP64__)
+	REBSER	*shape;		// Word list of the object it last selected in a path
+	REBCNT	slot;		// Index of the word in that word list
+#endif
 } REBWRD;
 
 typedef struct Reb_Word_Spec {
@@ -734,6 +740,13 @@ typedef struct Reb_Word_Spec {
 #define VAL_WORD_FRAME(v)		((v)->data.word.frame)
 #define HAS_FRAME(v)			VAL_WORD_FRAME(v)
 
+// Path selector cache (uses the room left in 64 bit values):
+#if defined(__LP64__) || defined(__LLP64__)
+#define HAS_SHAPE_CACHE
+#define VAL_WORD_SHAPE(v)		((v)->data.word.shape)
+#define VAL_WORD_SLOT(v)		((v)->data.word.slot)
+#endif
+
 #define	UNBIND(v)				VAL_WORD_FRAME(v)=0, VAL_WORD_INDEX(v)=0
 
 #define VAL_WORD_CANON(v)		VAL_SYM_CANON(BLK_SKIP(PG_Word_Table.series, VAL_WORD_SYM(v)))
@@ -762,13 +775,13 @@ typedef struct Reb_Word_Spec {
 typedef struct Reb_Frame {
 	REBSER	*words;
 	REBSER	*spec;
-//	REBSER	*parent;
+	REBSER	*parent;	// prototype sharing values with this frame (or self)
 } REBFRM;
 
 // Value to frame fields:
 #define	VAL_FRM_WORDS(v)	((v)->data.frame.words)
 #define	VAL_FRM_SPEC(v)		((v)->data.frame.spec)
-//#define	VAL_FRM_PARENT(v)	((v)->data.frame.parent)
+#define	VAL_FRM_PARENT(v)	((v)->data.frame.parent)
 
 // Word number array (used by Bind_Table):
 #define WORDS_HEAD(w)		((REBINT *)(w)->data)
@@ -781,6 +794,7 @@ typedef struct Reb_Frame {
 #define FRM_VALUE(c,n)		BLK_SKIP(c,(n))
 #define FRM_WORD(c,n)		BLK_SKIP(FRM_WORD_SERIES(c),(n))
 #define FRM_WORD_SYM(c,n)	VAL_BIND_SYM(FRM_WORD(c,n))
+#define FRM_PARENT(c)		VAL_FRM_PARENT(BLK_HEAD(c))
 
 #define VAL_FRM_WORD(v,n)	BLK_SKIP(FRM_WORD_SERIES(VAL_SERIES(v)),(n))
 
@@ -790,6 +804,7 @@ typedef struct Reb_Frame {
 #define SET_FRAME(v, s, w) \
 	VAL_FRM_SPEC(v) = (s); \
 	VAL_FRM_WORDS(v) = (w); \
+	VAL_FRM_PARENT(v) = 0; \
 	VAL_SET(v, REB_FRAME)
 
 #define SET_SELFLESS(f) VAL_BIND_SYM(FRM_WORDS(f)) = 0
@@ -946,6 +961,14 @@ typedef struct Reb_Function {
 #define VAL_FUNC_INFO(v)      ((v)->data.func.func.info)
 #define VAL_FUNC_ARGC(v)	  SERIES_TAIL((v)->data.func.args)
 
+// Call descriptor, kept in the unused typeset of slot zero of the
+// arg words (see Check_Func_Spec). Specs it does not describe keep
+// the ALL_64 of Init_Frame_Word.
+#define VAL_FUNC_DESC(v)	  VAL_BIND_TYPESET(BLK_HEAD(VAL_FUNC_WORDS(v)))
+#define FUNC_DESC_FIXED		  ((REBU64)1 << 32)	// leading args are all evaluated
+#define FUNC_DESC_ARGC(d)	  ((REBCNT)(d) & 0xff)	// number of leading args
+#define IS_FIXED_DESC(d)	  (((d) & ~(REBU64)0xff) == FUNC_DESC_FIXED)
+
 typedef struct Reb_Path_Value {
 	REBVAL *value;	// modified
 	REBVAL *select;	// modified
@@ -1071,6 +1094,7 @@ struct Reb_Routine_Info {
 	REBSER	*all_args;
 	REBSER  *arg_structs; /* for struct arguments */
 	REBSER	*extra_mem; /* extra memory that needs to be free'ed */
+	void	**arena; /* ffi argument pointers and temporaries, reused by each call */
 	REBINT	abi;
 	REBFLG	flags;
 };
@@ -1082,6 +1106,8 @@ enum {
 	ROUTINE_USED = 1 << 1,
 	ROUTINE_CALLBACK = 1 << 2, //this is a callback
 	ROUTINE_VARARGS = 1 << 3, //this is a function with varargs
+	ROUTINE_FAST_INT = 1 << 4, //called directly: pointer-sized integer arguments and return
+	ROUTINE_FAST_DEC = 1 << 5, //called directly: double arguments and return
 };
 
 /* argument is REBFCN */
@@ -1097,6 +1123,7 @@ enum {
 #define ROUTINE_FFI_ARG_STRUCTS(v)  (ROUTINE_INFO(v)->arg_structs)
 #define ROUTINE_EXTRA_MEM(v) 		(ROUTINE_INFO(v)->extra_mem)
 #define ROUTINE_CIF(v) 				(ROUTINE_INFO(v)->cif)
+#define ROUTINE_ARENA(v) 			(ROUTINE_INFO(v)->arena)
 #define ROUTINE_RVALUE(v) 			VAL_STRUCT((REBVAL*)SERIES_DATA(ROUTINE_INFO(v)->arg_structs))
 #define ROUTINE_CLOSURE(v)			(ROUTINE_INFO(v)->info.cb.closure)
 #define ROUTINE_DISPATCHER(v)		(ROUTINE_INFO(v)->info.cb.dispatcher)
@@ -1139,6 +1166,7 @@ enum {
 #define VAL_ROUTINE_FFI_ARG_STRUCTS(v)  (VAL_ROUTINE_INFO(v)->arg_structs)
 #define VAL_ROUTINE_EXTRA_MEM(v) 	(VAL_ROUTINE_INFO(v)->extra_mem)
 #define VAL_ROUTINE_CIF(v) 			(VAL_ROUTINE_INFO(v)->cif)
+#define VAL_ROUTINE_ARENA(v) 		(VAL_ROUTINE_INFO(v)->arena)
 #define VAL_ROUTINE_RVALUE(v) 		VAL_STRUCT((REBVAL*)SERIES_DATA(VAL_ROUTINE_INFO(v)->arg_structs))
 
 #define VAL_ROUTINE_CLOSURE(v)  	(VAL_ROUTINE_INFO(v)->info.cb.closure)
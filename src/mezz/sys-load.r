@@ -261,6 +261,42 @@ read-decode: function [
 	data
 ]
 
+load-body: function [
+	"Converts a script body to a block, using the module cache for files."
+	source "Where the body was read from"
+	body [binary!] "Script body (after the header)"
+][
+	; The cache holds the scanned form of the body (see ENCODE-BLOCK) in
+	; one file per source path, named by the checksum of the path. Its
+	; first value is the key: the path, modified date, size and body
+	; checksum of the source. Any mismatch is a miss, and rewrites it.
+	; Files are written under a temporary name then renamed, so other
+	; processes never see a partial file. Any failure just loads normally.
+	unless all [
+		file? source
+		dir: system/options/module-cache
+		info: attempt [query source]
+	][return to block! body]
+
+	key: reduce [info/name info/date info/size checksum/method body 'crc32]
+	file: join dir [enbase/base checksum/secure to binary! form info/name 16 %.rbi]
+	if all [
+		data: attempt [decode-block read file]
+		key = first data
+	][return second data]
+
+	; A body that cannot be encoded (see ENCODE-BLOCK) is not cached,
+	; and an old entry for the source is removed:
+	data: to block! body
+	unless attempt [
+		unless query dir [create dir]
+		write tmp: join file [%. access-os 'pid] encode-block reduce [key data]
+		rename tmp file
+		true
+	][attempt [delete file]]
+	data
+]
+
 load: function [
 	{Loads code or data from a file, URL, string, or binary.}
 	source [file! url! string! binary! block!] {Source or block of sources}
@@ -318,7 +354,7 @@ load: function [
 		; data is binary or block now, hdr is object or none
 
 		;-- Convert code to block, insert header if requested:
-		not block? data [data: to block! data]
+		not block? data [data: load-body source data]
 		header [insert data hdr]
 
 		;-- Bind code to user context:
@@ -603,7 +639,7 @@ load-module: function [
 						hdr/options: append any [hdr/options make block! 1] 'isolate
 					]
 				]
-				binary? code [code: to block! code]
+				binary? code [code: load-body source code]
 			]
 			assert/type [hdr object! code block!]
 			mod: reduce [hdr code do-needs/no-user hdr]
@@ -103,9 +103,9 @@ make-port*: func [
 				#"@" (emit user s1)
 			]
 
-			; optional host [:port]
+			; optional host [:port] (an IPv6 host is in brackets)
 			opt [
-				copy s1 any user-char
+				[#"[" copy s1 to #"]" skip | copy s1 any user-char]
 				opt [#":" copy s2 digits (compose/into [port-id: (to integer! s2)] tail out)]
 				(unless empty? s1 [attempt [s1: to tuple! s1] emit host s1])
 			]
@@ -169,55 +169,8 @@ init-schemes: func [
 	make-scheme [
 		title: "System Port"
 		name: 'system
-		awake: func [
-			sport "System port (State block holds events)"
-			ports "Port list (Copy of block passed to WAIT)"
-			/only
-			/local event event-list n-event port waked
-		][
-			waked: sport/data ; The wake list (pending awakes)
-
-			if only [
-				unless block? ports [return none] ;short cut for a pause
-			]
-
-			; Process all events (even if no awake ports).
-			n-event: 0
-			event-list: sport/state
-			while [not empty? event-list][
-				if n-event > 8 [break] ; Do only 8 events at a time (to prevent polling lockout).
-				event: first event-list
-				port: event/port
-				either any [
-					none? only
-					find ports port
-				][
-					remove event-list ;avoid event overflow caused by wake-up recursively calling into wait
-					if wake-up port event [
-						; Add port to wake list:
-						;print ["==System-waked:" port/spec/ref]
-						unless find waked port [append waked port]
-					]
-					++ n-event
-				][
-					event-list: next event-list
-				]
-			]
-
-			; No wake ports (just a timer), return now.
-			unless block? ports [return none]
-
-			; Are any of the requested ports awake?
-			forall ports [
-				if port: find waked first ports [return true]
-			]
-
-			either zero? n-event [
-				none ;events are ignored
-			][
-				false ; keep waiting
-			]
-		]
+		; Events in port/state are dispatched to the awake functions
+		; of their ports natively by WAIT (see Awake_System).
 		init: func [port] [
 			;;print ["Init" title]
 			port/data: copy [] ; The port wake list
@@ -287,6 +240,12 @@ init-schemes: func [
 		awake: func [event] [print ['UDP-event event/type] true]
 	]
 
+	make-scheme [
+		title: "Timer"
+		name: 'timer
+		awake: func [event] [true]
+	]
+
 	make-scheme [
 		title: "Clipboard"
 		name: 'clipboard
@@ -298,6 +257,11 @@ init-schemes: func [
 			name: 'signal
 			spec: system/standard/port-spec-signal
 		]
+		make-scheme [
+			title: "Process"
+			name: 'process
+			spec: system/standard/port-spec-process
+		]
 	]
 
 	make-scheme [
@@ -24,6 +24,9 @@
 **  Purpose: Calls local DNS services for domain name lookup.
 **  Notes:
 **      See MS WSAAsyncGetHost* details regarding multiple requests.
+**      Other systems use the resolver below: it sends UDP queries
+**      to the servers in /etc/resolv.conf (or REBOL_DNS) without
+**      blocking, and results complete via the device poll.
 **
 ************************************************************************
 **
@@ -45,6 +48,12 @@
 #include "host-lib.h"
 #include "sys-net.h"
 
+#ifndef HAS_ASYNC_DNS
+#include <time.h>
+#include <sys/stat.h>
+#include <arpa/inet.h>
+#endif
+
 extern DEVICE_CMD Init_Net(REBREQ *); // Share same init
 extern DEVICE_CMD Quit_Net(REBREQ *);
 
@@ -53,8 +62,669 @@ extern void Signal_Device(REBREQ *req, REBINT type);
 #ifdef HAS_ASYNC_DNS
 // Async DNS requires a window handle to signal completion (WSAASync)
 extern HWND Event_Handle;
+
+/***********************************************************************
+**
+*/	static void Set_Host_Result(REBREQ *sock)
+/*
+**		Convert the HOSTENT buffer of a completed request into
+**		the REBDNS result the port reads (and free the buffer).
+**
+***********************************************************************/
+{
+	HOSTENT *host = (HOSTENT*)sock->net.host_info;
+	REBDNS *dns = OS_Make(sizeof(REBDNS));
+	char **addr;
+
+	CLEARS(dns);
+	if (GET_FLAG(sock->modes, RST_REVERSE))
+		strncpy(dns->name, host->h_name, sizeof(dns->name) - 1);
+	else {
+		for (addr = host->h_addr_list; *addr && dns->count < MAX_DNS_ADDRS; addr++) {
+			dns->addrs[dns->count].family = 4;
+			COPY_MEM(dns->addrs[dns->count++].addr, *addr, 4);
+		}
+		COPY_MEM((char*)&(sock->net.remote_ip), (char *)(*host->h_addr_list), 4);
+	}
+	OS_Free(host);
+	sock->net.host_info = dns;
+}
+
+#else
+
+/***********************************************************************
+**
+**	Non-blocking Resolver
+**
+**		Each lookup sends an A and an AAAA query (or a PTR query for
+**		a reverse lookup) over UDP and returns at once. The device
+**		poll collects the replies, resends on timeout (rotating
+**		through the servers), and completes the request. Numeric
+**		addresses, /etc/hosts and cached answers complete at once.
+**
+**		The REBOL_DNS environment variable (ip or ip:port) replaces
+**		the resolv.conf servers; it is read for each lookup.
+**
+***********************************************************************/
+
+#define DNS_SERVERS		3		// resolv.conf MAXNS
+#define DNS_PACKET		512		// UDP message limit (no EDNS)
+#define DNS_RETRY		1000	// msec before resending a query
+#define DNS_TIMEOUT		5000	// msec for the lookup (if no req timeout)
+#define DNS_CACHE		32		// cached answers
+#define DNS_HOSTS_TTL	5		// secs to cache /etc/hosts answers
+#define DNS_MAX_TTL		86400
+
+#define DNS_A			1
+#define DNS_PTR			12
+#define DNS_AAAA		28
+
+typedef struct dns_server {
+	struct sockaddr_storage addr;
+	socklen_t len;
+} DNS_SERVER;
+
+typedef struct dns_query {
+	int udp[2];				// query sockets (IPv4, IPv6 servers)
+	u16 id[2];				// query ids
+	u8 wait;				// queries not yet answered (bits)
+	u8 count;				// number of queries (1 or 2)
+	u16 tries;				// transmissions so far
+	i64 sent;				// time of the last transmission
+	i64 deadline;			// when to give up
+	u32 ttl;				// lowest answer ttl
+	int len[2];				// query packet sizes
+	u8 packet[2][300];		// query packets (kept for resending)
+	char name[256];			// name asked for (cache key)
+} DNSQ;
+
+typedef struct dns_cache {
+	i64 expires;
+	char name[256];
+	REBDNS dns;
+} DNS_CACHE_ENTRY;
+
+static INSTANCE DNS_SERVER Servers[DNS_SERVERS];
+static INSTANCE int Num_Servers;
+static INSTANCE char Search_Domain[256];
+static INSTANCE time_t Conf_Time;		// resolv.conf mtime when loaded
+static INSTANCE DNS_CACHE_ENTRY Dns_Cache[DNS_CACHE];
+
+
+/***********************************************************************
+**
+*/	static int Parse_Server(char *str, int port, DNS_SERVER *server)
+/*
+**		Parse a server address, with an optional port when given
+**		as ip:port or [ip6]:port. Returns FALSE if not an address.
+**
+***********************************************************************/
+{
+	struct sockaddr_in *in4 = (struct sockaddr_in*)&server->addr;
+	struct sockaddr_in6 *in6 = (struct sockaddr_in6*)&server->addr;
+	char buf[64];
+	char *cp;
+
+	strncpy(buf, str, sizeof(buf) - 1);
+	buf[sizeof(buf) - 1] = 0;
+	str = buf;
+
+	if (*str == '[') {
+		str++;
+		if (!(cp = strchr(str, ']'))) return FALSE;
+		*cp++ = 0;
+		if (*cp == ':') port = atoi(cp + 1);
+	}
+	else if ((cp = strchr(str, ':')) && !strchr(cp + 1, ':')) {
+		*cp = 0;
+		port = atoi(cp + 1);
+	}
+
+	CLEARS(&server->addr);
+	if (inet_pton(AF_INET, str, &in4->sin_addr) == 1) {
+		in4->sin_family = AF_INET;
+		in4->sin_port = htons((u16)port);
+		server->len = sizeof(*in4);
+		return TRUE;
+	}
+	if (inet_pton(AF_INET6, str, &in6->sin6_addr) == 1) {
+		in6->sin6_family = AF_INET6;
+		in6->sin6_port = htons((u16)port);
+		server->len = sizeof(*in6);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Load_Config(void)
+/*
+**		Load the servers and search domain from resolv.conf when it
+**		has changed. REBOL_DNS takes the place of its servers.
+**
+***********************************************************************/
+{
+	struct stat info;
+	char line[256];
+	char word[64];
+	char *env;
+	FILE *file;
+
+	env = getenv("REBOL_DNS");
+	if (stat("/etc/resolv.conf", &info)) info.st_mtime = 0;
+
+	if (!env && Conf_Time && info.st_mtime == Conf_Time) return;
+	Conf_Time = info.st_mtime;
+	Num_Servers = 0;
+	Search_Domain[0] = 0;
+
+	if ((file = fopen("/etc/resolv.conf", "r"))) {
+		while (fgets(line, sizeof(line), file)) {
+			if (sscanf(line, "nameserver %63s", word) == 1) {
+				if (Num_Servers < DNS_SERVERS && Parse_Server(word, 53, &Servers[Num_Servers]))
+					Num_Servers++;
+			}
+			else if (sscanf(line, "search %63s", word) == 1 || sscanf(line, "domain %63s", word) == 1)
+				strcpy(Search_Domain, word);
+		}
+		fclose(file);
+	}
+
+	if (env && Parse_Server(env, 53, &Servers[0])) Num_Servers = 1;
+
+	// Same default as the C library:
+	if (!Num_Servers) Parse_Server("127.0.0.1", 53, &Servers[Num_Servers++]);
+}
+
+
+/***********************************************************************
+**
+*/	static void Add_Address(REBDNS *dns, int family, u8 *addr)
+/*
+***********************************************************************/
+{
+	if (dns->count >= MAX_DNS_ADDRS) return;
+	dns->addrs[dns->count].family = family;
+	COPY_MEM(dns->addrs[dns->count++].addr, addr, family == 4 ? 4 : 16);
+}
+
+
+/***********************************************************************
+**
+*/	static void Order_Addresses(REBDNS *dns)
+/*
+**		Put IPv4 addresses before IPv6 (stable), as the replies
+**		may arrive in either order.
+**
+***********************************************************************/
+{
+	REBDNSA tmp;
+	u32 n, m;
+
+	for (n = 1; n < dns->count; n++) {
+		tmp = dns->addrs[n];
+		for (m = n; m > 0 && dns->addrs[m-1].family > tmp.family; m--)
+			dns->addrs[m] = dns->addrs[m-1];
+		dns->addrs[m] = tmp;
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static int Check_Hosts(char *name, u8 *rev, REBDNS *dns)
+/*
+**		Look up a name (or a reverse IPv4 address) in /etc/hosts.
+**
+***********************************************************************/
+{
+	char line[512];
+	char *addr, *host, *save;
+	u8 bin[16];
+	FILE *file;
+	int family;
+
+	if (!(file = fopen("/etc/hosts", "r"))) return FALSE;
+
+	while (fgets(line, sizeof(line), file)) {
+		if ((host = strchr(line, '#'))) *host = 0;
+		if (!(addr = strtok_r(line, " \t\r\n", &save))) continue;
+		if (inet_pton(AF_INET, addr, bin) == 1) family = 4;
+		else if (inet_pton(AF_INET6, addr, bin) == 1) family = 6;
+		else continue;
+		while ((host = strtok_r(0, " \t\r\n", &save))) {
+			if (rev) {
+				if (family == 4 && !memcmp(bin, rev, 4)) {
+					strncpy(dns->name, host, sizeof(dns->name) - 1);
+					break;
+				}
+			}
+			else if (!strcasecmp(host, name)) {
+				Add_Address(dns, family, bin);
+				break;
+			}
+		}
+		if (rev && dns->name[0]) break;
+	}
+	fclose(file);
+
+	Order_Addresses(dns);
+	return dns->count > 0 || dns->name[0];
+}
+
+
+/***********************************************************************
+**
+*/	static int Check_Cache(char *name, REBDNS *dns)
+/*
+***********************************************************************/
+{
+	i64 now = OS_Delta_Time(0, 0);
+	int n;
+
+	for (n = 0; n < DNS_CACHE; n++) {
+		if (Dns_Cache[n].expires > now && !strcasecmp(Dns_Cache[n].name, name)) {
+			*dns = Dns_Cache[n].dns;
+			dns->ttl = (u32)((Dns_Cache[n].expires - now) / 1000000);
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Cache_Result(char *name, REBDNS *dns)
+/*
+**		Keep an answer for its TTL, replacing the entry for the
+**		same name, or else the entry that expires first.
+**
+***********************************************************************/
+{
+	DNS_CACHE_ENTRY *entry = 0;
+	int n;
+
+	if (!dns->ttl) return;
+
+	for (n = 0; n < DNS_CACHE; n++) {
+		if (!strcasecmp(Dns_Cache[n].name, name)) {
+			entry = &Dns_Cache[n];
+			break;
+		}
+	}
+
+	if (!entry) {
+		entry = &Dns_Cache[0];
+		for (n = 1; n < DNS_CACHE; n++) {
+			if (Dns_Cache[n].expires < entry->expires) entry = &Dns_Cache[n];
+		}
+	}
+
+	entry->expires = OS_Delta_Time(0, 0) + (i64)MIN(dns->ttl, DNS_MAX_TTL) * 1000000;
+	strcpy(entry->name, name);
+	entry->dns = *dns;
+}
+
+
+/***********************************************************************
+**
+*/	static u16 Query_Id(void)
+/*
+**		Make an id for a query. It must not be predictable, or
+**		a forged response could match it before the server's.
+**
+***********************************************************************/
+{
+	FILE *file;
+	u16 id;
+
+	if ((file = fopen("/dev/urandom", "rb"))) {
+		int n = fread(&id, sizeof(id), 1, file);
+		fclose(file);
+		if (n == 1) return id;
+	}
+
+	// No system source, so the best that can be had here:
+	return (u16)(rand() ^ (OS_Delta_Time(0, 0) >> 4));
+}
+
+
+/***********************************************************************
+**
+*/	static int Make_Query(u8 *buf, u16 id, char *name, int type)
+/*
+**		Build a recursive query for one name and record type.
+**		Returns the packet length, or zero for an invalid name.
+**
+***********************************************************************/
+{
+	u8 *cp = buf + 12;
+	char *dot;
+	int n;
+
+	CLEAR(buf, 12);
+	buf[0] = id >> 8;
+	buf[1] = (u8)id;
+	buf[2] = 1;		// recursion desired
+	buf[5] = 1;		// one question
+
+	while (*name) {
+		dot = strchr(name, '.');
+		n = dot ? dot - name : strlen(name);
+		if (n == 0 || n > 63 || cp + n + 6 > buf + 300) return 0;
+		*cp++ = n;
+		COPY_MEM(cp, name, n);
+		cp += n;
+		name += n;
+		if (*name) name++;
+	}
+	*cp++ = 0;
+	*cp++ = 0;
+	*cp++ = type;
+	*cp++ = 0;
+	*cp++ = 1;		// class IN
+
+	return cp - buf;
+}
+
+
+/***********************************************************************
+**
+*/	static u8 *Read_Name(u8 *msg, u8 *end, u8 *cp, char *out)
+/*
+**		Skip a (compressed) name, copying it to out if given.
+**		Returns the position after the name, or zero if invalid.
+**
+***********************************************************************/
+{
+	u8 *next = 0;
+	int len = 0;
+	int hops = 0;
+	int n;
+
+	while (cp < end) {
+		n = *cp;
+		if ((n & 0xC0) == 0xC0) {
+			if (cp + 1 >= end || ++hops > 16) return 0;
+			if (!next) next = cp + 2;
+			cp = msg + ((n & 0x3F) << 8 | cp[1]);
+			continue;
+		}
+		if (n & 0xC0) return 0;
+		cp++;
+		if (!n) {
+			if (out) out[len ? len - 1 : 0] = 0;
+			return next ? next : cp;
+		}
+		if (cp + n > end) return 0;
+		if (out && len + n + 1 < 256) {
+			COPY_MEM(out + len, cp, n);
+			len += n;
+			out[len++] = '.';
+		}
+		cp += n;
+	}
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static int Read_Reply(DNSQ *q, REBDNS *dns, u8 *msg, int len)
+/*
+**		Take the answers of a reply to one of our queries.
+**		Returns the query index or -1 if the reply is not ours.
+**
+***********************************************************************/
+{
+	u8 *end = msg + len;
+	u8 *cp;
+	u16 id;
+	int which, num, type, size;
+	u32 ttl;
+
+	if (len < 12 || !(msg[2] & 0x80)) return -1;
+
+	id = msg[0] << 8 | msg[1];
+	for (which = 0; which < q->count; which++)
+		if (id == q->id[which] && (q->wait & (1 << which))) break;
+	if (which == q->count) return -1;
+
+	// The question must match ours:
+	num = q->len[which] - 12;
+	if (len < q->len[which] || memcmp(msg + 12, q->packet[which] + 12, num)) return -1;
+
+	// Server failure or refusal: leave it for another try.
+	if ((msg[3] & 15) != 0 && (msg[3] & 15) != 3) return -1;
+
+	cp = msg + q->len[which];
+	for (num = msg[6] << 8 | msg[7]; num > 0; num--) {
+		if (!(cp = Read_Name(msg, end, cp, 0)) || cp + 10 > end) break;
+		type = cp[0] << 8 | cp[1];
+		ttl = (u32)cp[4] << 24 | cp[5] << 16 | cp[6] << 8 | cp[7];
+		size = cp[8] << 8 | cp[9];
+		cp += 10;
+		if (cp + size > end) break;
+		if (type == DNS_A && size == 4) Add_Address(dns, 4, cp);
+		else if (type == DNS_AAAA && size == 16) Add_Address(dns, 6, cp);
+		else if (type == DNS_PTR && !dns->name[0]) Read_Name(msg, end, cp, dns->name);
+		else type = 0;
+		if (type && ttl < q->ttl) q->ttl = ttl;
+		cp += size;
+	}
+
+	return which;
+}
+
+
+/***********************************************************************
+**
+*/	static void Send_Queries(DNSQ *q)
+/*
+**		Send the unanswered queries to the next server.
+**
+***********************************************************************/
+{
+	DNS_SERVER *server = &Servers[q->tries++ % Num_Servers];
+	int family = server->addr.ss_family == AF_INET6;
+	int n;
+
+	if (q->udp[family] < 0) {
+		q->udp[family] = socket(family ? AF_INET6 : AF_INET, SOCK_DGRAM, 0);
+		if (q->udp[family] < 0) return;
+		fcntl(q->udp[family], F_SETFL, O_NONBLOCK);
+	}
+
+	for (n = 0; n < q->count; n++) {
+		if (q->wait & (1 << n))
+			sendto(q->udp[family], q->packet[n], q->len[n], 0, (struct sockaddr*)&server->addr, server->len);
+	}
+	q->sent = OS_Delta_Time(0, 0);
+}
+
+
+/***********************************************************************
+**
+*/	static void Free_Query(REBREQ *req)
+/*
+***********************************************************************/
+{
+	DNSQ *q = (DNSQ*)req->handle;
+
+	if (q) {
+		if (q->udp[0] >= 0) CLOSE_SOCKET(q->udp[0]);
+		if (q->udp[1] >= 0) CLOSE_SOCKET(q->udp[1]);
+		OS_Free(q);
+	}
+	req->handle = 0;
+}
+
+
+/***********************************************************************
+**
+*/	int Start_Lookup(REBREQ *req)
+/*
+**		Begin a lookup of req->data (a host name) or, for
+**		RST_REVERSE, of the req->net.remote_ip address.
+**		The REBDNS result is allocated in req->net.host_info and
+**		the query state is kept in req->handle.
+**
+**		Returns DR_DONE when answered at once (address, hosts or
+**		cache), DR_PEND while querying, or DR_ERROR.
+**
+***********************************************************************/
+{
+	REBDNS *dns;
+	DNSQ *q;
+	u8 *ip = (u8*)&req->net.remote_ip;
+	char name[256];
+	int n;
+
+	dns = OS_Make(sizeof(REBDNS));
+	CLEARS(dns);
+	req->net.host_info = dns;
+	req->handle = 0;
+	req->error = 0;
+
+	if (GET_FLAG(req->modes, RST_REVERSE)) {
+		sprintf(name, "%d.%d.%d.%d.in-addr.arpa", ip[3], ip[2], ip[1], ip[0]);
+		if (Check_Cache(name, dns) || Check_Hosts(0, ip, dns)) return DR_DONE;
+	}
+	else {
+		if (!req->data || strlen((char*)req->data) >= sizeof(name) - 64) goto not_found;
+		strcpy(name, (char*)req->data);
+
+		// A numeric address needs no lookup:
+		if (inet_pton(AF_INET, name, dns->addrs[0].addr) == 1) n = 4;
+		else if (inet_pton(AF_INET6, name, dns->addrs[0].addr) == 1) n = 6;
+		else n = 0;
+		if (n) {
+			dns->addrs[0].family = n;
+			dns->count = 1;
+			return DR_DONE;
+		}
+		if (Check_Cache(name, dns)) return DR_DONE;
+		if (Check_Hosts(name, 0, dns)) {
+			dns->ttl = DNS_HOSTS_TTL;
+			Cache_Result(name, dns);
+			return DR_DONE;
+		}
+	}
+
+	q = OS_Make(sizeof(DNSQ));
+	CLEARS(q);
+	q->udp[0] = q->udp[1] = -1;
+	q->ttl = DNS_MAX_TTL;
+	strcpy(q->name, name); // cached as asked, to match Check_Cache
+	req->handle = q;
+
+	Load_Config();
+
+	// A single label is qualified by the search domain:
+	if (!strchr(name, '.') && Search_Domain[0]) {
+		strcat(name, ".");
+		strcat(name, Search_Domain);
+	}
+
+	n = GET_FLAG(req->modes, RST_REVERSE);
+	q->count = n ? 1 : 2;
+	for (n = 0; n < q->count; n++) {
+		q->id[n] = Query_Id();
+		q->len[n] = Make_Query(q->packet[n], q->id[n], name,
+			q->count == 1 ? DNS_PTR : (n ? DNS_AAAA : DNS_A));
+		if (!q->len[n]) {
+			Free_Query(req);
+			goto not_found;
+		}
+	}
+	q->wait = q->count == 1 ? 1 : 3;
+	q->deadline = OS_Delta_Time(0, 0) + (i64)(req->timeout ? req->timeout : DNS_TIMEOUT) * 1000;
+
+	Send_Queries(q);
+	return DR_PEND;
+
+not_found:
+	req->error = HOST_NOT_FOUND;
+	return DR_ERROR;
+}
+
+
+/***********************************************************************
+**
+*/	int Check_Lookup(REBREQ *req)
+/*
+**		Collect replies for a pending lookup and resend when due.
+**		Returns DR_PEND until done, then DR_DONE or DR_ERROR.
+**
+***********************************************************************/
+{
+	DNSQ *q = (DNSQ*)req->handle;
+	REBDNS *dns = (REBDNS*)req->net.host_info;
+	DNS_SERVER *server;
+	struct sockaddr_storage from;
+	socklen_t from_len;
+	u8 msg[DNS_PACKET];
+	int len, n, f;
+	i64 now;
+
+	if (!q) return req->error ? DR_ERROR : DR_DONE;
+
+	for (f = 0; f < 2; f++) {
+		if (q->udp[f] < 0) continue;
+		while (q->wait) {
+			from_len = sizeof(from);
+			len = recvfrom(q->udp[f], msg, sizeof(msg), 0, (struct sockaddr*)&from, &from_len);
+			if (len < 0) break;
+			// Only accept replies from our servers:
+			for (n = 0; n < Num_Servers; n++) {
+				server = &Servers[n];
+				if (from_len == server->len && !memcmp(&from, &server->addr, from_len)) break;
+			}
+			if (n == Num_Servers) continue;
+			n = Read_Reply(q, dns, msg, len);
+			if (n >= 0) q->wait &= ~(1 << n);
+		}
+	}
+
+	if (q->wait) {
+		now = OS_Delta_Time(0, 0);
+		if (now < q->deadline) {
+			if (now - q->sent >= DNS_RETRY * 1000) Send_Queries(q);
+			return DR_PEND;
+		}
+		q->ttl = 0; // partial answer: do not cache it
+	}
+
+	Order_Addresses(dns);
+	if (dns->count || dns->name[0]) {
+		dns->ttl = q->ttl;
+		Cache_Result(q->name, dns);
+		if (!GET_FLAG(req->modes, RST_REVERSE))
+			for (n = dns->count - 1; n >= 0; n--)
+				if (dns->addrs[n].family == 4) COPY_MEM(&req->net.remote_ip, dns->addrs[n].addr, 4);
+	}
+	else req->error = q->wait ? TRY_AGAIN : HOST_NOT_FOUND;
+
+	Free_Query(req);
+	return req->error ? DR_ERROR : DR_DONE;
+}
+
+
+/***********************************************************************
+**
+*/	void Cancel_Lookup(REBREQ *req)
+/*
+***********************************************************************/
+{
+	Free_Query(req);
+}
+
 #endif
 
+
 /***********************************************************************
 **
 */	DEVICE_CMD Open_DNS(REBREQ *sock)
@@ -80,6 +750,9 @@ extern HWND Event_Handle;
 		CLR_FLAG(sock->flags, RRF_PENDING);
 		if (sock->handle) WSACancelAsyncRequest(sock->handle);
 	}
+#else
+	CLR_FLAG(sock->flags, RRF_PENDING);
+	Cancel_Lookup(sock);
 #endif
 	if (sock->net.host_info) OS_Free(sock->net.host_info);
 	sock->net.host_info = 0;
@@ -98,16 +771,12 @@ extern HWND Event_Handle;
 **
 ***********************************************************************/
 {
-	void *host;
 #ifdef HAS_ASYNC_DNS
+	void *host;
 	HANDLE handle;
-#else
-	HOSTENT *he;
-#endif
 
 	host = OS_Make(MAXGETHOSTSTRUCT); // be sure to free it
 
-#ifdef HAS_ASYNC_DNS
 	if (!GET_FLAG(sock->modes, RST_REVERSE)) // hostname lookup
 		handle = WSAAsyncGetHostByName(Event_Handle, WM_DNS, sock->data, host, MAXGETHOSTSTRUCT);
 	else
@@ -118,27 +787,6 @@ extern HWND Event_Handle;
 		sock->handle = handle;
 		return DR_PEND; // keep it on pending list
 	}
-#else
-	// Use old-style blocking DNS (mainly for testing purposes):
-	if (GET_FLAG(sock->modes, RST_REVERSE)) {
-		he = gethostbyaddr((char*)&sock->net.remote_ip, 4, AF_INET);
-		if (he) {
-			sock->net.host_info = host; //???
-			sock->data = he->h_name;
-			SET_FLAG(sock->flags, RRF_DONE);
-			return DR_DONE;
-		}
-	}
-	else {
-		he = gethostbyname(sock->data);
-		if (he) {
-			sock->net.host_info = host; // ?? who deallocs?
-			COPY_MEM((char*)&(sock->net.remote_ip), (char *)(*he->h_addr_list), 4); //he->h_length);
-			SET_FLAG(sock->flags, RRF_DONE);
-			return DR_DONE;
-		}
-	}
-#endif
 
 	OS_Free(host);
 	sock->net.host_info = 0;
@@ -146,6 +794,22 @@ extern HWND Event_Handle;
 	sock->error = GET_ERROR;
 	//Signal_Device(sock, EVT_ERROR);
 	return DR_ERROR; // Remove it from pending list
+#else
+	int result;
+
+	// Drop the result of a prior read:
+	Cancel_Lookup(sock);
+	if (sock->net.host_info) OS_Free(sock->net.host_info);
+
+	result = Start_Lookup(sock);
+	if (result == DR_DONE) SET_FLAG(sock->flags, RRF_DONE);
+	else CLR_FLAG(sock->flags, RRF_DONE);
+	if (result == DR_ERROR) {
+		OS_Free(sock->net.host_info);
+		sock->net.host_info = 0;
+	}
+	return result;
+#endif
 }
 
 
@@ -153,8 +817,9 @@ extern HWND Event_Handle;
 **
 */	DEVICE_CMD Poll_DNS(REBREQ *dr)
 /*
-**		Check for completed DNS requests. These are marked with
-**		RRF_DONE by the windows message event handler (dev-event.c).
+**		Check for completed DNS requests. On Windows these are
+**		marked with RRF_DONE by the message event handler
+**		(dev-event.c); otherwise the resolver checks for replies.
 **		Completed requests are removed from the pending queue and
 **		event is signalled (for awake dispatch).
 **
@@ -164,11 +829,13 @@ extern HWND Event_Handle;
 	REBREQ **prior = &dev->pending;
 	REBREQ *req;
 	REBOOL change = FALSE;
-	HOSTENT *host;
 
 	// Scan the pending request list:
 	for (req = *prior; req; req = *prior) {
 
+#ifndef HAS_ASYNC_DNS
+		if (Check_Lookup(req) != DR_PEND) SET_FLAG(req->flags, RRF_DONE);
+#endif
 		// If done or error, remove command from list:
 		if (GET_FLAG(req->flags, RRF_DONE)) { // req->error may be set
 			*prior = req->next;
@@ -176,11 +843,9 @@ extern HWND Event_Handle;
 			CLR_FLAG(req->flags, RRF_PENDING);
 
 			if (!req->error) { // success!
-				host = (HOSTENT*)req->net.host_info;
-				if (GET_FLAG(req->modes, RST_REVERSE))
-					req->data = host->h_name;
-				else
-					COPY_MEM((char*)&(req->net.remote_ip), (char *)(*host->h_addr_list), 4); //he->h_length);
+#ifdef HAS_ASYNC_DNS
+				Set_Host_Result(req);
+#endif
 				Signal_Device(req, EVT_READ);
 			}
 			else
@@ -193,7 +858,6 @@ extern HWND Event_Handle;
 	return change;
 }
 
-
 /***********************************************************************
 **
 **	Command Dispatch Table (RDC_ enum order)
@@ -61,6 +61,13 @@ typedef int socklen_t;
 extern HWND Event_Handle; // For WSAAsync API
 #endif
 
+#ifndef HAS_ASYNC_DNS
+// Resolver (dev-dns.c):
+extern int Start_Lookup(REBREQ *req);
+extern int Check_Lookup(REBREQ *req);
+extern void Cancel_Lookup(REBREQ *req);
+#endif
+
 
 /***********************************************************************
 **
@@ -68,25 +75,77 @@ extern HWND Event_Handle; // For WSAAsync API
 **
 ***********************************************************************/
 
-static void Set_Addr(SOCKAI *sa, long ip, int port)
+#define CONNECT_DELAY	250		// msec before racing the next address (RFC 8305)
+
+// Connection attempts to the addresses of a host (in host_info):
+typedef struct net_race {
+	REBDNS dns;					// addresses in the order to try
+	u32 next;					// next address to try
+	int error;					// error of the last failed attempt
+	i64 started;				// time of the last attempt
+	SOCKET socks[MAX_DNS_ADDRS];	// attempts in progress (or BAD_SOCKET)
+} NET_RACE;
+
+static int Set_Addr(SOCKAS *sa, int family, u8 *ip, int port)
 {
 	// Set the IP address and port number in a socket_addr struct.
+	// Family is 4 or 6. Returns the size of the address.
+	SOCKAI *sa4 = (SOCKAI*)sa;
+#ifdef HAS_IPV6
+	struct sockaddr_in6 *sa6 = (struct sockaddr_in6*)sa;
+#endif
 	memset(sa, 0, sizeof(*sa));
-	sa->sin_family = AF_INET;
-	sa->sin_addr.s_addr = ip;  //htonl(ip); NOTE: REBOL stays in network byte order
-	sa->sin_port = htons((unsigned short)port);
+#ifdef HAS_IPV6
+	if (family == 6) {
+		sa6->sin6_family = AF_INET6;
+		COPY_MEM(&sa6->sin6_addr, ip, 16);
+		sa6->sin6_port = htons((unsigned short)port);
+		return sizeof(*sa6);
+	}
+#endif
+	sa4->sin_family = AF_INET;
+	COPY_MEM(&sa4->sin_addr.s_addr, ip, 4);  // NOTE: REBOL stays in network byte order
+	sa4->sin_port = htons((unsigned short)port);
+	return sizeof(*sa4);
+}
+
+static int Set_Remote_Addr(REBREQ *sock, SOCKAS *sa)
+{
+	// Set the remote address of the request, for the socket family.
+	if (GET_FLAG(sock->modes, RST_IPV6))
+		return Set_Addr(sa, 6, sock->net.remote_ip6, sock->net.remote_port);
+	return Set_Addr(sa, 4, (u8*)&sock->net.remote_ip, sock->net.remote_port);
+}
+
+static void Get_Addr(SOCKAS *sa, u32 *ip, u8 *ip6, u32 *port)
+{
+	// Get the IP address and port number of a socket_addr struct.
+	// An IPv4 address on an IPv6 socket (::ffff:a.b.c.d) also
+	// sets the IPv4 field.
+#ifdef HAS_IPV6
+	struct sockaddr_in6 *sa6 = (struct sockaddr_in6*)sa;
+
+	if (sa6->sin6_family == AF_INET6) {
+		COPY_MEM(ip6, &sa6->sin6_addr, 16);
+		if (IN6_IS_ADDR_V4MAPPED(&sa6->sin6_addr)) COPY_MEM(ip, ip6 + 12, 4);
+		else *ip = 0;
+		*port = ntohs(sa6->sin6_port);
+		return;
+	}
+#endif
+	*ip = ((SOCKAI*)sa)->sin_addr.s_addr; // NOTE: REBOL stays in network byte order
+	*port = ntohs(((SOCKAI*)sa)->sin_port);
 }
 
 static void Get_Local_IP(REBREQ *sock)
 {
 	// Get the local IP address and port number.
 	// This code should be fast and never fail.
-	SOCKAI sa;
-	int len = sizeof(sa);
+	SOCKAS sa;
+	socklen_t len = sizeof(sa);
 
 	getsockname(sock->socket, (struct sockaddr *)&sa, &len);
-	sock->net.local_ip = sa.sin_addr.s_addr; //htonl(ip); NOTE: REBOL stays in network byte order
-	sock->net.local_port = ntohs(sa.sin_port);
+	Get_Addr(&sa, &sock->net.local_ip, sock->net.local_ip6, &sock->net.local_port);
 }
 
 static REBOOL Nonblocking_Mode(SOCKET sock)
@@ -104,6 +163,156 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 #endif
 }
 
+static SOCKET Make_Socket(REBREQ *sock, int family)
+{
+	// Make a non-blocking socket of the family (4 or 6) and the
+	// request's protocol. Returns BAD_SOCKET on error.
+	SOCKET result;
+	int type = SOCK_STREAM;
+	int protocol = IPPROTO_TCP;	// TCP is default
+
+	if (GET_FLAG(sock->modes, RST_UDP)) {
+		type = SOCK_DGRAM;
+		protocol = IPPROTO_UDP;
+	}
+
+#ifdef HAS_IPV6
+	result = (SOCKET)socket(family == 6 ? AF_INET6 : AF_INET, type, protocol);
+#else
+	if (family == 6) return BAD_SOCKET;
+	result = (SOCKET)socket(AF_INET, type, protocol);
+#endif
+	if (result == BAD_SOCKET) return result;
+
+	if (!Nonblocking_Mode(result)) {
+		CLOSE_SOCKET(result);
+		return BAD_SOCKET;
+	}
+
+#ifdef HAS_SO_NOSIGPIPE
+	{
+		int val = 1;
+		setsockopt(result, SOL_SOCKET, SO_NOSIGPIPE, &val, sizeof(val));
+	}
+#endif
+
+	return result;
+}
+
+static REBOOL Connect_Pending(int error)
+{
+	switch (error) {
+#ifdef TO_WIN32
+	case NE_INVALID:	// Corrects for Microsoft bug
+#endif
+	case NE_WOULDBLOCK:
+	case NE_INPROGRESS:
+	case NE_ALREADY:
+		return TRUE;
+	}
+	return FALSE;
+}
+
+static void Set_Race(REBREQ *sock, REBDNS *dns)
+{
+	// Keep the looked up addresses for Connect_Socket, in the
+	// order to try them: families alternate, IPv6 first (RFC 8305).
+	NET_RACE *race = OS_Make(sizeof(NET_RACE));
+	u32 n, v6 = 0, v4 = 0;
+
+	CLEARS(race);
+	for (n = 0; n < MAX_DNS_ADDRS; n++) race->socks[n] = BAD_SOCKET;
+
+	while (race->dns.count < dns->count) {
+		for (; v6 < dns->count && dns->addrs[v6].family != 6; v6++);
+		if (v6 < dns->count) race->dns.addrs[race->dns.count++] = dns->addrs[v6++];
+		for (; v4 < dns->count && dns->addrs[v4].family != 4; v4++);
+		if (v4 < dns->count) race->dns.addrs[race->dns.count++] = dns->addrs[v4++];
+	}
+
+	// Show an address before the connection is made:
+	for (n = 0; n < dns->count && dns->addrs[n].family != 4; n++);
+	if (n < dns->count) COPY_MEM(&sock->net.remote_ip, dns->addrs[n].addr, 4);
+
+	sock->net.host_info = race;
+}
+
+static void Free_Race(REBREQ *sock)
+{
+	// Close the connection attempts that did not win.
+	NET_RACE *race = (NET_RACE*)sock->net.host_info;
+	u32 n;
+
+	if (!race) return;
+	for (n = 0; n < race->next; n++)
+		if (race->socks[n] != BAD_SOCKET) CLOSE_SOCKET(race->socks[n]);
+	OS_Free(race);
+	sock->net.host_info = 0;
+}
+
+static int Race_Connect(REBREQ *sock)
+{
+	// Connect to the first of the host addresses that answers.
+	// An attempt starts when the prior one fails or has not
+	// succeeded within CONNECT_DELAY, and they run in parallel.
+	NET_RACE *race = (NET_RACE*)sock->net.host_info;
+	REBDNSA *addr;
+	SOCKAS sa;
+	int pending = 0;
+	int result;
+	u32 n;
+
+	for (n = 0; n < race->dns.count; n++) {
+
+		// Start the next attempt if none is pending or it is slow:
+		if (n == race->next) {
+			if (pending && OS_Delta_Time(race->started, 0) < CONNECT_DELAY * 1000) break;
+			race->next++;
+			race->started = OS_Delta_Time(0, 0);
+			race->socks[n] = Make_Socket(sock, race->dns.addrs[n].family);
+			if (race->socks[n] == BAD_SOCKET) {
+				race->error = GET_ERROR;
+				continue;
+			}
+		}
+		if (race->socks[n] == BAD_SOCKET) continue;
+
+		// Check the attempt (connect again reports its state):
+		addr = &race->dns.addrs[n];
+		result = connect(race->socks[n], (struct sockaddr *)&sa, Set_Addr(&sa, addr->family, addr->addr, sock->net.remote_port));
+		if (result != 0) result = GET_ERROR;
+
+		if (result == 0 || result == NE_ISCONN) {
+			// The winner replaces the socket made by Open_Socket:
+			CLOSE_SOCKET(sock->socket);
+			sock->socket = race->socks[n];
+			race->socks[n] = BAD_SOCKET;
+			if (addr->family == 6) {
+				SET_FLAG(sock->modes, RST_IPV6);
+				COPY_MEM(sock->net.remote_ip6, addr->addr, 16);
+				sock->net.remote_ip = 0;
+			}
+			else COPY_MEM(&sock->net.remote_ip, addr->addr, 4);
+			Free_Race(sock);
+			return DR_DONE;
+		}
+
+		if (Connect_Pending(result)) pending++;
+		else {
+			CLOSE_SOCKET(race->socks[n]);
+			race->socks[n] = BAD_SOCKET;
+			race->error = result;
+		}
+	}
+
+	if (pending) return DR_PEND;
+
+	// Every address failed:
+	sock->error = race->error;
+	Free_Race(sock);
+	return DR_ERROR;
+}
+
 
 /***********************************************************************
 **
@@ -187,25 +396,15 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 **
 ***********************************************************************/
 {
-	int type;
-    int	protocol;
-	long result;
+	SOCKET result;
 
 	sock->error = 0;
 	sock->state = 0;  // clear all flags
+	CLR_FLAG(sock->modes, RST_IPV6);
 
-	// Setup for correct type and protocol:
-	if (GET_FLAG(sock->modes, RST_UDP)) {
-		type = SOCK_DGRAM;
-		protocol = IPPROTO_UDP;
-	}
-	else {	// TCP is default
-		type = SOCK_STREAM;
-		protocol = IPPROTO_TCP;
-	}
-
-	// Bind to the transport service, return socket handle or error:
-	result = (int)socket(AF_INET, type, protocol);
+	// Bind to the transport service, return socket handle or error.
+	// (IPv4 until a connection or listen needs another family.)
+	result = Make_Socket(sock, 4);
 
 	// Failed, get error code (os local):
 	if (result == BAD_SOCKET) {
@@ -217,20 +416,6 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	sock->socket = result;
 	SET_FLAG(sock->state, RSM_OPEN);
 
-	// Set socket to non-blocking async mode:
-	if (!Nonblocking_Mode(sock->socket)) {
-		sock->error = GET_ERROR;
-        Signal_Device(sock, EVT_ERROR);
-		return DR_ERROR;
-	}
-
-#ifdef HAS_SO_NOSIGPIPE
-	{
-		int val = 1;
-		setsockopt(sock->socket, SOL_SOCKET, SO_NOSIGPIPE, &val, sizeof(val));
-	}
-#endif
-
 	return DR_DONE;
 }
 
@@ -250,17 +435,23 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 
 	if (GET_FLAG(sock->state, RSM_OPEN)) {
 
-		sock->state = 0;  // clear: RSM_OPEN, RSM_CONNECT
-
 		// If DNS pending, abort it:
-		if (sock->net.host_info) {  // indicates DNS phase active
+		if (GET_FLAG(sock->state, RSM_LOOKUP)) {
 #ifdef HAS_ASYNC_DNS
 			if (sock->handle) WSACancelAsyncRequest(sock->handle);
+#else
+			Cancel_Lookup(sock);
 #endif
 			OS_Free(sock->net.host_info);
+			sock->net.host_info = 0;
 			sock->socket = sock->length; // Restore TCP socket (see Lookup)
 		}
 
+		// Stop connection attempts (see Connect):
+		Free_Race(sock);
+
+		sock->state = 0;  // clear: RSM_OPEN, RSM_CONNECT
+
 		if (CLOSE_SOCKET(sock->socket)) {
 			sock->error = GET_ERROR;
 			Signal_Device(sock, EVT_ERROR);
@@ -278,63 +469,93 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 /*
 **		Initiate the GetHost request and return immediately.
 **		This is very similar to the DNS device.
-**		The request will pend until the main event handler gets WM_DNS.
+**		The request will pend until the main event handler gets WM_DNS
+**		(or, on other systems, until the resolver gets its reply).
 **		Note the temporary results buffer (must be freed later).
 **		Note we use the sock->handle for the DNS handle. During use,
 **		we store the TCP socket in the length field.
 **
+**		The addresses found are kept for Connect_Socket.
+**
 ***********************************************************************/
 {
-#ifdef TO_WIN32
+	REBDNS *dns;
+#ifdef HAS_ASYNC_DNS
 	HANDLE handle;
-#endif
 	HOSTENT *host;
+	char **addr;
 
-#ifdef HAS_ASYNC_DNS
 	// Check if we are polling for completion:
-	if (host = (HOSTENT*)(sock->net.host_info)) {
+	if (GET_FLAG(sock->state, RSM_LOOKUP)) {
+		host = (HOSTENT*)(sock->net.host_info);
 		// The windows main event handler will change this when it gets WM_DNS event:
 		if (!GET_FLAG(sock->flags, RRF_DONE)) return DR_PEND; // still waiting
 		CLR_FLAG(sock->flags, RRF_DONE);
+		CLR_FLAG(sock->state, RSM_LOOKUP);
+		sock->socket = sock->length; // Restore TCP socket saved below
+		sock->net.host_info = 0;
 		if (!sock->error) { // Success!
-			host = (HOSTENT*)sock->net.host_info;
-			COPY_MEM((char*)&(sock->net.remote_ip), (char *)(*host->h_addr_list), 4); //he->h_length);
+			dns = OS_Make(sizeof(REBDNS));
+			CLEARS(dns);
+			for (addr = host->h_addr_list; *addr && dns->count < MAX_DNS_ADDRS; addr++) {
+				dns->addrs[dns->count].family = 4;
+				COPY_MEM(dns->addrs[dns->count++].addr, *addr, 4);
+			}
+			Set_Race(sock, dns);
+			OS_Free(dns);
 			Signal_Device(sock, EVT_LOOKUP);
 		}
 		else
 			Signal_Device(sock, EVT_ERROR);
 		OS_Free(host);	// free what we allocated earlier
-		sock->socket = sock->length; // Restore TCP socket saved below
-		sock->net.host_info = 0;
 		return DR_DONE;
 	}
 
 	// Else, make the lookup request:
+	Free_Race(sock); // (from a prior lookup)
 	host = OS_Make(MAXGETHOSTSTRUCT); // be sure to free it
 	handle = WSAAsyncGetHostByName(Event_Handle, WM_DNS, sock->data, (char*)host, MAXGETHOSTSTRUCT);
 	if (handle != 0) {
 		sock->net.host_info = host;
 		sock->length = sock->socket; // save TCP socket temporarily
 		sock->handle = handle;
+		SET_FLAG(sock->state, RSM_LOOKUP);
 		return DR_PEND; // keep it on pending list
 	}
 	OS_Free(host);
+
+	sock->error = GET_ERROR;
+	Signal_Device(sock, EVT_ERROR);
+	return DR_ERROR; // Remove it from pending list
 #else
-	// Use old-style blocking DNS (mainly for testing purposes):
-	host = gethostbyname(sock->data);
-	sock->net.host_info = 0; // no allocated data
+	int result;
+
+	// Check if we are polling for completion, else make the request
+	// (the resolver is in dev-dns.c):
+	if (GET_FLAG(sock->state, RSM_LOOKUP)) result = Check_Lookup(sock);
+	else {
+		Free_Race(sock); // (from a prior lookup)
+		sock->length = sock->socket; // save TCP socket temporarily
+		SET_FLAG(sock->state, RSM_LOOKUP);
+		result = Start_Lookup(sock);
+	}
+	if (result == DR_PEND) return DR_PEND;
 
-	if (host) {
-		COPY_MEM((char*)&(sock->net.remote_ip), (char *)(*host->h_addr_list), 4); //he->h_length);
+	CLR_FLAG(sock->state, RSM_LOOKUP);
+	sock->socket = sock->length; // Restore TCP socket saved above
+	dns = (REBDNS*)sock->net.host_info;
+	sock->net.host_info = 0;
+	if (!sock->error) Set_Race(sock, dns);
+	OS_Free(dns);
+
+	if (!sock->error) {
 		CLR_FLAG(sock->flags, RRF_DONE);
 		Signal_Device(sock, EVT_LOOKUP);
 		return DR_DONE;
 	}
-#endif
-
-	sock->error = GET_ERROR;
 	Signal_Device(sock, EVT_ERROR);
-	return DR_ERROR; // Remove it from pending list
+	return DR_ERROR;
+#endif
 }
 
 
@@ -346,6 +567,10 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 **		Only required for connection-based protocols (e.g. not UDP).
 **		The IP address must already be resolved before calling.
 **
+**		When the lookup found several addresses, they are tried
+**		in parallel, staggered by CONNECT_DELAY (happy eyeballs),
+**		and the first to connect is used.
+**
 **		This function is asynchronous. It will return immediately.
 **		You can call this function again to check the pending connection.
 **
@@ -359,8 +584,10 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 **
 ***********************************************************************/
 {
+	NET_RACE *race = (NET_RACE*)sock->net.host_info;
+	SOCKET udp;
 	int result;
-	SOCKAI sa;
+	SOCKAS sa;
 
 	if (GET_FLAG(sock->modes, RST_LISTEN))
 		return Listen_Socket(sock);
@@ -368,6 +595,16 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	if (GET_FLAG(sock->state, RSM_CONNECT)) return DR_DONE; // already connected 
 
 	if (GET_FLAG(sock->modes, RST_UDP)) {
+		// Datagrams go to the first address found:
+		if (race && race->dns.count && race->dns.addrs[0].family == 6) {
+			udp = Make_Socket(sock, 6);
+			if (udp == BAD_SOCKET) goto error;
+			CLOSE_SOCKET(sock->socket);
+			sock->socket = udp;
+			SET_FLAG(sock->modes, RST_IPV6);
+			COPY_MEM(sock->net.remote_ip6, race->dns.addrs[0].addr, 16);
+		}
+		Free_Race(sock);
 		CLR_FLAG(sock->state, RSM_ATTEMPT);
 		SET_FLAG(sock->state, RSM_CONNECT);
 		Get_Local_IP(sock);
@@ -375,17 +612,22 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 		return DR_DONE; // done
 	}
 
-	Set_Addr(&sa, sock->net.remote_ip, sock->net.remote_port);
-	result = connect(sock->socket, (struct sockaddr *)&sa, sizeof(sa));
-
-	if (result != 0) result = GET_ERROR;
-
-	WATCH2("connect() error: %d - %s\n", result, strerror(result));
+	if (race) result = Race_Connect(sock);
+	else {
+		result = connect(sock->socket, (struct sockaddr *)&sa, Set_Remote_Addr(sock, &sa));
+		if (result != 0) result = GET_ERROR;
+		WATCH2("connect() error: %d - %s\n", result, strerror(result));
+		if (result == NE_ISCONN) result = DR_DONE;
+		else if (Connect_Pending(result)) result = DR_PEND;
+		else if (result) {
+			sock->error = result;
+			result = DR_ERROR;
+		}
+	}
 
 	switch (result) {
 
-	case 0: // no error
-	case NE_ISCONN:
+	case DR_DONE:
 		// Connected, set state:
 		CLR_FLAG(sock->state, RSM_ATTEMPT);
 		SET_FLAG(sock->state, RSM_CONNECT);
@@ -393,23 +635,21 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 		Signal_Device(sock, EVT_CONNECT);
 		return DR_DONE; // done
 
-#ifdef TO_WIN32
-	case NE_INVALID:	// Corrects for Microsoft bug
-#endif
-	case NE_WOULDBLOCK:
-	case NE_INPROGRESS:
-	case NE_ALREADY:
+	case DR_PEND:
 		// Still trying:
 		SET_FLAG(sock->state, RSM_ATTEMPT);
 		return DR_PEND;
-
-	default:
-		// An error happened:
-		CLR_FLAG(sock->state, RSM_ATTEMPT);
-		sock->error = result;
-		Signal_Device(sock, EVT_ERROR);
-		return DR_ERROR;
 	}
+
+	// An error happened:
+	CLR_FLAG(sock->state, RSM_ATTEMPT);
+	Signal_Device(sock, EVT_ERROR);
+	return DR_ERROR;
+
+error:
+	sock->error = GET_ERROR;
+	Signal_Device(sock, EVT_ERROR);
+	return DR_ERROR;
 }
 
 
@@ -441,7 +681,7 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 {
 	int result;
 	long len;
-	SOCKAI remote_addr;
+	SOCKAS remote_addr;
 	socklen_t addr_len = sizeof(remote_addr);
 	int mode = (sock->command == RDC_READ ? RSM_RECEIVE : RSM_SEND);
 
@@ -463,7 +703,7 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 #ifdef HAS_MSG_NOSIGNAL
 		flags |= MSG_NOSIGNAL;
 #endif
-		Set_Addr(&remote_addr, sock->net.remote_ip, sock->net.remote_port);
+		addr_len = Set_Remote_Addr(sock, &remote_addr);
 		result = sendto(sock->socket, sock->data, len, flags,
 						(struct sockaddr*)&remote_addr, addr_len);
 		WATCH2("send() len: %d actual: %d\n", len, result);
@@ -486,10 +726,8 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 		WATCH2("recv() len: %d result: %d\n", len, result);
 
 		if (result > 0) {
-			if (GET_FLAG(sock->modes, RST_UDP)) {
-				sock->net.remote_ip = remote_addr.sin_addr.s_addr;
-				sock->net.remote_port = ntohs(remote_addr.sin_port);
-			}
+			if (GET_FLAG(sock->modes, RST_UDP))
+				Get_Addr(&remote_addr, &sock->net.remote_ip, sock->net.remote_ip6, &sock->net.remote_port);
 			sock->actual = result;
 			Signal_Device(sock, EVT_READ);
 			return DR_DONE;
@@ -528,17 +766,36 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 **
 **		Use this instead of Connect_Socket().
 **
+**		Where the system has IPv6, the socket accepts IPv6 and
+**		IPv4 (as ::ffff:a.b.c.d) both.
+**
 ***********************************************************************/
 {
 	int result;
-	int len = 1;
-	SOCKAI sa;
+	int len;
+	int on = 1;
+	SOCKAS sa;
+	u8 any[16] = {0};
+#ifdef HAS_IPV6
+	SOCKET s6;
+
+	if (!GET_FLAG(sock->modes, RST_IPV6) && (s6 = Make_Socket(sock, 6)) != BAD_SOCKET) {
+		len = 0;
+		if (setsockopt(s6, IPPROTO_IPV6, IPV6_V6ONLY, (char*)(&len), sizeof(len)))
+			CLOSE_SOCKET(s6); // IPv6 only: keep IPv4
+		else {
+			CLOSE_SOCKET(sock->socket);
+			sock->socket = s6;
+			SET_FLAG(sock->modes, RST_IPV6);
+		}
+	}
+#endif
 
 	// Setup socket address range and port:
-	Set_Addr(&sa, INADDR_ANY, sock->net.local_port);
+	len = Set_Addr(&sa, GET_FLAG(sock->modes, RST_IPV6) ? 6 : 4, any, sock->net.local_port);
 
 	// Allow listen socket reuse:
-	result = setsockopt(sock->socket, SOL_SOCKET, SO_REUSEADDR, (char*)(&len), sizeof(len));
+	result = setsockopt(sock->socket, SOL_SOCKET, SO_REUSEADDR, (char*)(&on), sizeof(on));
 	if (result) {
 lserr:
 		sock->error = GET_ERROR;
@@ -547,7 +804,7 @@ lserr:
 	}
 
 	// Bind the socket to our local address:
-	result = bind(sock->socket, (struct sockaddr *)&sa, sizeof(sa));
+	result = bind(sock->socket, (struct sockaddr *)&sa, len);
 	if (result) goto lserr;
 
 	SET_FLAG(sock->state, RSM_BIND);
@@ -584,9 +841,9 @@ lserr:
 **
 ***********************************************************************/
 {
-	SOCKAI sa;
+	SOCKAS sa;
 	REBREQ *news;
-	int len = sizeof(sa);
+	socklen_t len = sizeof(sa);
 	int result;
 	extern void Attach_Request(REBREQ **prior, REBREQ *req);
 
@@ -615,8 +872,8 @@ lserr:
 	SET_FLAG(news->state, RSM_CONNECT);
 
 	news->socket = result;
-	news->net.remote_ip   = sa.sin_addr.s_addr; //htonl(ip); NOTE: REBOL stays in network byte order
-	news->net.remote_port = ntohs(sa.sin_port);
+	if (GET_FLAG(sock->modes, RST_IPV6)) SET_FLAG(news->modes, RST_IPV6);
+	Get_Addr(&sa, &news->net.remote_ip, news->net.remote_ip6, &news->net.remote_port);
 	Get_Local_IP(news);
 
 	Nonblocking_Mode(news->socket);
@@ -55,6 +55,10 @@
 #include "reb-host.h"
 #include "host-lib.h"
 
+#if defined(INSTANCES) && !defined(TO_WIN32)
+#include <pthread.h>
+#endif
+
 
 /***********************************************************************
 **
@@ -77,6 +81,9 @@ extern REBDEV Dev_Serial;
 #ifdef HAS_POSIX_SIGNAL
 extern REBDEV Dev_Signal;
 #endif
+#ifdef HAS_POSIX_PROCESS
+extern REBDEV Dev_Process;
+#endif
 
 REBDEV *Devices[RDI_LIMIT] =
 {
@@ -95,10 +102,77 @@ REBDEV *Devices[RDI_LIMIT] =
 	&Dev_Serial,
 #ifdef HAS_POSIX_SIGNAL
 	&Dev_Signal,
+#endif
+#ifdef HAS_POSIX_PROCESS
+	&Dev_Process,
 #endif
 	0,
 };
 
+#ifdef INSTANCES
+// Each interpreter thread works on its own copy of the devices above,
+// so the pending request lists are never shared between threads. The
+// devices themselves are shared: they are initialized (and the console
+// opened) once for the process, in the Devices table, under a lock.
+static INSTANCE REBDEV Thread_Devs[RDI_LIMIT];
+static INSTANCE REBDEV *Thread_Table[RDI_LIMIT];
+#ifdef TO_WIN32
+static SRWLOCK Devices_Lock = SRWLOCK_INIT;
+#define LOCK_DEVICES()   AcquireSRWLockExclusive(&Devices_Lock)
+#define UNLOCK_DEVICES() ReleaseSRWLockExclusive(&Devices_Lock)
+#else
+static pthread_mutex_t Devices_Lock = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_DEVICES()   pthread_mutex_lock(&Devices_Lock)
+#define UNLOCK_DEVICES() pthread_mutex_unlock(&Devices_Lock)
+#endif
+#else
+#define LOCK_DEVICES()
+#define UNLOCK_DEVICES()
+#endif
+
+// Device events refused by a full event queue. They are sent again,
+// in order, when the devices are next polled, so a completed request
+// is never lost (see Signal_Device).
+typedef struct rebol_deferred_event {
+	struct rebol_deferred_event *next;
+	REBEVT evt;
+} REBDEFER;
+
+static INSTANCE REBDEFER *Deferred_Head;
+static INSTANCE REBDEFER *Deferred_Tail;
+
+
+/***********************************************************************
+**
+*/	REBDEV **OS_Devices(void)
+/*
+**		Return the device table of the calling thread. It is the
+**		shared Devices table unless built with INSTANCES, where the
+**		first call from a thread copies the devices with empty
+**		pending lists. Only the pending lists of a copy are its own;
+**		the init and open state is kept in Devices.
+**
+***********************************************************************/
+{
+#ifdef INSTANCES
+	int d;
+
+	if (!Thread_Table[RDI_STDIO]) {
+		LOCK_DEVICES();
+		for (d = 0; d < RDI_LIMIT; d++) {
+			if (!Devices[d]) continue;
+			Thread_Devs[d] = *Devices[d];
+			Thread_Devs[d].pending = 0;
+			Thread_Table[d] = &Thread_Devs[d];
+		}
+		UNLOCK_DEVICES();
+	}
+	return Thread_Table;
+#else
+	return Devices;
+#endif
+}
+
 
 static int Poll_Default(REBDEV *dev)
 {
@@ -215,7 +289,7 @@ static int Poll_Default(REBDEV *dev)
 	REBREQ *req;
 
 	for (d = RDI_NET; d <= RDI_DNS; d++) {
-		dev = Devices[d];
+		dev = OS_Devices()[d];
 		prior = &dev->pending;
 		// Scan the pending requests, mark the one we got:
 		for (req = *prior; req; req = *prior) {
@@ -239,6 +313,7 @@ static int Poll_Default(REBDEV *dev)
 ***********************************************************************/
 {
 	REBEVT evt;
+	REBDEFER *defer;
 
 	CLEARS(&evt);
 
@@ -247,7 +322,39 @@ static int Poll_Default(REBDEV *dev)
 	evt.req  = req;
 	if (type == EVT_ERROR) evt.data = req->error;
 
-	RL_Event(&evt);	// (returns 0 if queue is full, ignored)
+	// Queue it after any deferred events, or defer it if the queue is full:
+	if (!Deferred_Head && RL_Event(&evt)) return;
+
+	defer = OS_Make(sizeof(REBDEFER));
+	if (!defer) return;
+	defer->next = 0;
+	defer->evt = evt;
+	if (Deferred_Tail) Deferred_Tail->next = defer;
+	else Deferred_Head = defer;
+	Deferred_Tail = defer;
+}
+
+
+/***********************************************************************
+**
+*/	static int Send_Deferred(void)
+/*
+**		Send the deferred device events, in order, while the event
+**		queue takes them. Returns TRUE if any was sent.
+**
+***********************************************************************/
+{
+	REBDEFER *defer;
+	int sent = FALSE;
+
+	while ((defer = Deferred_Head) && RL_Event(&defer->evt)) {
+		Deferred_Head = defer->next;
+		if (!Deferred_Head) Deferred_Tail = 0;
+		OS_Free(defer);
+		sent = TRUE;
+	}
+
+	return sent;
 }
 
 
@@ -269,7 +376,7 @@ static int Poll_Default(REBDEV *dev)
 	REBREQ req;
 
 	// Validate device:
-	if (device >= RDI_MAX || !(dev = Devices[device]))
+	if (device >= RDI_MAX || !(dev = OS_Devices()[device]))
 		return -1;
 
 	// Validate command:
@@ -304,20 +411,28 @@ static int Poll_Default(REBDEV *dev)
 	req->error = 0; // A94 - be sure its cleared
 
 	// Validate device:
-	if (req->device >= RDI_MAX || !(dev = Devices[req->device])) {
+	if (req->device >= RDI_MAX || !(dev = OS_Devices()[req->device])) {
 		req->error = RDE_NO_DEVICE;
 		return -1;
 	}
 
 	// Confirm device is initialized. If not, return an error or init
-	// it if auto init option is set.
+	// it if auto init option is set. That is done once per process, on
+	// the shared device; the flag of a thread's copy only records that
+	// the thread has seen it done (see OS_Devices).
 	if (!GET_FLAG(dev->flags, RDF_INIT)) {
+		REBDEV *shared = Devices[req->device];
 		if (GET_FLAG(dev->flags, RDO_MUST_INIT)) {
 			req->error = RDE_NO_INIT;
 			return -1;
 		}
-		if (!dev->commands[RDC_INIT] || !dev->commands[RDC_INIT]((REBREQ*)dev))
-		SET_FLAG(dev->flags, RDF_INIT);
+		LOCK_DEVICES();
+		if (!GET_FLAG(shared->flags, RDF_INIT)) {
+			if (!shared->commands[RDC_INIT] || !shared->commands[RDC_INIT]((REBREQ*)shared))
+			SET_FLAG(shared->flags, RDF_INIT);
+		}
+		if (GET_FLAG(shared->flags, RDF_INIT)) SET_FLAG(dev->flags, RDF_INIT);
+		UNLOCK_DEVICES();
 	}
 
 	// Validate command:
@@ -354,7 +469,7 @@ static int Poll_Default(REBDEV *dev)
 	int size;
 
 	// Validate device:
-	if (device >= RDI_MAX || !(dev = Devices[device]))
+	if (device >= RDI_MAX || !(dev = OS_Devices()[device]))
 		return 0;
 
 	size = dev->req_size ? dev->req_size : sizeof(REBREQ);
@@ -378,7 +493,7 @@ static int Poll_Default(REBDEV *dev)
 {
 	REBDEV *dev;
 
-	if ((dev = Devices[req->device]) != 0) Detach_Request(&dev->pending, req);
+	if ((dev = OS_Devices()[req->device]) != 0) Detach_Request(&dev->pending, req);
 	return 0;
 }
 
@@ -406,9 +521,12 @@ static int Poll_Default(REBDEV *dev)
 
 	//printf("Polling Devices\n");
 
+	// Events the queue refused before go first:
+	if (Send_Deferred()) cnt++;
+
 	// Check each device:
 	for (d = 0; d < RDI_MAX; d++) {
-		dev = Devices[d];
+		dev = OS_Devices()[d];
 		if (dev && (dev->pending || GET_FLAG(dev->flags, RDO_AUTO_POLL))) {
 			// If there is a custom polling function, use it:
 			if (dev->commands[RDC_POLL]) {
@@ -442,9 +560,16 @@ static int Poll_Default(REBDEV *dev)
 {
 	int d;
 	REBDEV *dev;
+	REBDEFER *defer;
+
+	while ((defer = Deferred_Head)) {
+		Deferred_Head = defer->next;
+		OS_Free(defer);
+	}
+	Deferred_Tail = 0;
 
 	for (d = RDI_MAX-1; d >= 0; d--) {
-		dev = Devices[d];
+		dev = Devices[d]; // shared by all threads
 		if (dev && GET_FLAG(dev->flags, RDF_INIT) && dev->commands[RDC_QUIT]) {
 			dev->commands[RDC_QUIT]((REBREQ*)dev);
 		}
@@ -456,17 +581,18 @@ static int Poll_Default(REBDEV *dev)
 
 /***********************************************************************
 **
-*/	REBINT OS_Wait(REBCNT millisec, REBCNT res)
+*/	REBINT OS_Wait(REBCNT microsec, REBCNT res)
 /*
 **		Check if devices need attention, and if not, then wait.
 **		The wait can be interrupted by a GUI event, otherwise
 **		the timeout will wake it.
 **
 **		Res specifies resolution. (No wait if less than this.)
+**		Both are in microseconds.
 **
 **		Returns:
 **			-1: Devices have changed state.
-**		     0: past given millsecs
+**		     0: past given microsecs
 **			 1: wait in timer
 **
 **		The time it takes for the devices to be scanned is
@@ -478,7 +604,7 @@ static int Poll_Default(REBDEV *dev)
 	REBCNT delta;
 	i64 base;
 
-	// printf("OS_Wait %d\n", millisec);
+	// printf("OS_Wait %d\n", microsec);
 
 	base = OS_Delta_Time(0, 0); // start timing
 
@@ -492,12 +618,12 @@ static int Poll_Default(REBDEV *dev)
 	if (OS_Poll_Devices()) return -1;
 
 	// Nothing, so wait for period of time
-	delta = (REBCNT)OS_Delta_Time(base, 0)/1000 + res;
-	if (delta >= millisec) return 0;
-	millisec -= delta;  // account for time lost above
-	req.length = millisec;
+	delta = (REBCNT)OS_Delta_Time(base, 0) + res;
+	if (delta >= microsec) return 0;
+	microsec -= delta;  // account for time lost above
+	req.length = microsec;
 
-	// printf("Wait: %d ms\n", millisec);
+	// printf("Wait: %d us\n", microsec);
 	OS_Do_Device(&req, RDC_QUERY); // wait for timer or other event
 
 	return 1;  // layer above should check delta again
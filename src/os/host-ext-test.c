@@ -68,6 +68,9 @@ char *RX_Spec =
 	"img0:   command [{return 10x20 image}]\n"
 	"cec0:   command [{test command context struct} blk [block!]]\n"
 	"cec1:   command [{returns cec.index value or -1 if no cec}]\n"
+	"xarg9:  command [{return ninth arg} a b c d e f g h i]\n"
+	"xsum:   command [{sum of a vector, from its data} vec [vector!]]\n"
+	"xsq:    command [{square of a number} num [integer! decimal!]]\n"
 
 	"a: b: c: none\n"
 	"xtest: does [\n"
@@ -91,6 +94,11 @@ char *RX_Spec =
 			"[img0]\n"
 			"[c: do-commands [a: xarg0 b: xarg1 333 xobj1 system 'version] reduce [a b c]]\n"
 			"[cec0 [a: cec1 b: cec1 c: cec1] reduce [a b c]]\n"
+			"[xarg9 1 2 3 4 5 6 7 8 9]\n"
+			"[xsum make vector! [integer! 32 [1 2 3]]]\n"
+			"[xsum make vector! [decimal! 64 [0.5 1.5]]]\n"
+			"[call-each :xsq [1 2 3.0]]\n"
+			"[call-each :xsq make vector! [integer! 32 [1 2 3]]]\n"
 		"][\n"
 			"print [{test:} mold blk]\n"
 			"prin {      } \n"
@@ -221,6 +229,36 @@ RXIEXT int RX_Call(int cmd, RXIFRM *frm, REBCEC *ctx) {
 		RXA_TYPE(frm, 1) = RXT_INTEGER;
 		break;
 
+	case 11:
+		RXA_ARG(frm, 1) = RXA_ARG(frm, 9);
+		RXA_TYPE(frm, 1) = RXA_XTYPE(frm, 9);
+		break;
+
+	case 12:
+		{
+			u32 len;
+			u32 n;
+			void *data = RXA_DATA(frm, 1);
+			REBSER *ser = RXA_SERIES(frm, 1);
+			double sum = 0;
+
+			RL_SERIES_DATA(ser, RXA_INDEX(frm, 1), &len);
+			for (n = 0; n < len; n++) switch (RL_SERIES(ser, RXI_SER_TYPE)) {
+			case RXI_VEC_I32: sum += ((i32 *)data)[n]; break;
+			case RXI_VEC_I64: sum += ((i64 *)data)[n]; break;
+			case RXI_VEC_F64: sum += ((double *)data)[n]; break;
+			default: return RXR_BAD_ARGS;
+			}
+			RXA_DEC64(frm, 1) = sum;
+			RXA_TYPE(frm, 1) = RXT_DECIMAL;
+		}
+		break;
+
+	case 13:
+		if (RXA_TYPE(frm, 1) == RXT_DECIMAL) RXA_DEC64(frm, 1) *= RXA_DEC64(frm, 1);
+		else RXA_INT64(frm, 1) *= RXA_INT64(frm, 1);
+		break;
+
 	default:
 		return RXR_NO_COMMAND;
 	}
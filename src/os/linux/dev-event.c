@@ -42,10 +42,15 @@
 #include <string.h>
 #include <unistd.h>
 #include <sys/time.h>
+#include <sys/select.h>
 
 #include "reb-host.h"
 #include "host-lib.h"
 
+#ifdef HAS_POSIX_PROCESS
+int Process_Fds(fd_set *in_fds, fd_set *out_fds, int max_fd);
+#endif
+
 
 #ifndef REB_CORE
 #include  <X11/Xlib.h>
@@ -100,30 +105,38 @@ void X_Finish_Resizing();
 **
 */	DEVICE_CMD Query_Events(REBREQ *req)
 /*
-**		Wait for an event, or a timeout (in milliseconds) specified by
+**		Wait for an event, or a timeout (in microseconds) specified by
 **		req->length. The latter is used by WAIT as the main timing
 **		method.
 **
+**		Process pipes with I/O outstanding also end the wait, so
+**		their ports are serviced as soon as the pipe is ready.
+**
 ***********************************************************************/
 {
 	struct timeval tv;
 	int result;
 	fd_set in_fds;
-	int x11_fd = 0;
+	fd_set out_fds;
+	int max_fd = 0;
 
-	tv.tv_sec = 0;
-	tv.tv_usec = req->length * 1000;
+	tv.tv_sec = req->length / 1000000;
+	tv.tv_usec = req->length % 1000000;
 	FD_ZERO(&in_fds);
+	FD_ZERO(&out_fds);
 	//printf("usec %d\n", tv.tv_usec);
 	
 #ifndef REB_CORE
 	if (global_x_info->display != NULL) {
-		x11_fd = ConnectionNumber(global_x_info->display);
+		max_fd = ConnectionNumber(global_x_info->display);
 
-		FD_SET(x11_fd, &in_fds);
+		FD_SET(max_fd, &in_fds);
 	}
 #endif
-	select(x11_fd+1, &in_fds, 0, 0, &tv);
+#ifdef HAS_POSIX_PROCESS
+	max_fd = Process_Fds(&in_fds, &out_fds, max_fd);
+#endif
+	select(max_fd+1, &in_fds, &out_fds, 0, &tv);
 
 	Poll_Events(NULL);
 
@@ -0,0 +1,493 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Title: Device: Child processes on Linux
+**  Purpose:
+**      Runs a command as a child process with its stdin and stdout
+**      on non-blocking pipes. A READ takes the next output chunk and
+**      a WRITE feeds the input, both progressing as the device is
+**      polled, so a port can read and write at the same time.
+**
+************************************************************************
+**
+**  NOTE to PROGRAMMERS:
+**
+**    1. Keep code clear and simple.
+**    2. Document unusual code, reasoning, or gotchas.
+**    3. Use same style for code, vars, indent(4), comments, etc.
+**    4. Keep in mind Linux, OS X, BSD, big/little endian CPUs.
+**    5. Test everything, then test it again.
+**
+***********************************************************************/
+#define _GNU_SOURCE             /* pipe2 */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/select.h>
+
+#include "reb-host.h"
+#include "host-lib.h"
+
+#ifdef HAS_POSIX_PROCESS
+
+#define PRC_BUF_SIZE 32768
+
+typedef struct process {
+	struct process *next;	// live process list (for the reaper)
+	int pid;
+	int in;					// pipe to the child stdin, -1 when closed
+	int out;				// pipe from the child stdout, -1 at EOF
+	int status;				// wait status (once exited)
+	int exited;
+	u32 want;				// size of the outstanding read, or 0
+	int closing;			// close stdin once the writes are done
+	REBYTE *wdata;			// data still to be written
+	u32 wlen;
+	u32 wdone;
+	REBYTE buf[PRC_BUF_SIZE];
+} REBPRC;
+
+static INSTANCE REBPRC *Processes;
+
+extern void Signal_Device(REBREQ *req, REBINT type);
+
+
+/***********************************************************************
+**
+*/	void Exited_Process(int pid, int status)
+/*
+**		Record the exit of a child reaped elsewhere (OS_Reap_Process),
+**		so its port can still report the exit code.
+**
+***********************************************************************/
+{
+	REBPRC *prc;
+
+	for (prc = Processes; prc; prc = prc->next) {
+		if (prc->pid == pid) {
+			prc->status = status;
+			prc->exited = 1;
+			return;
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	int Process_Fds(fd_set *in_fds, fd_set *out_fds, int max_fd)
+/*
+**		Add the pipes with a read or write outstanding to the sets
+**		the event device waits on (Query_Events), so output wakes
+**		WAIT at once. Returns the highest fd in the sets.
+**
+***********************************************************************/
+{
+	REBPRC *prc;
+
+	for (prc = Processes; prc; prc = prc->next) {
+		if (prc->want && prc->out >= 0 && prc->out < FD_SETSIZE) {
+			FD_SET(prc->out, in_fds);
+			if (prc->out > max_fd) max_fd = prc->out;
+		}
+		if (prc->wlen && prc->in >= 0 && prc->in < FD_SETSIZE) {
+			FD_SET(prc->in, out_fds);
+			if (prc->in > max_fd) max_fd = prc->in;
+		}
+	}
+
+	return max_fd;
+}
+
+
+/***********************************************************************
+**
+*/	static void Update_Process(REBREQ *req, REBPRC *prc)
+/*
+**		Reap the child if it has exited and set its exit code
+**		(128 + signal number when killed by a signal).
+**
+***********************************************************************/
+{
+	int status;
+
+	if (!prc->exited && waitpid(prc->pid, &status, WNOHANG) == prc->pid) {
+		prc->status = status;
+		prc->exited = 1;
+	}
+
+	if (!prc->exited) req->process.exit_code = -1;
+	else if (WIFEXITED(prc->status)) req->process.exit_code = WEXITSTATUS(prc->status);
+	else if (WIFSIGNALED(prc->status)) req->process.exit_code = 128 + WTERMSIG(prc->status);
+	else req->process.exit_code = -1;
+}
+
+
+/***********************************************************************
+**
+*/	static ssize_t Write_Pipe(int fd, REBYTE *data, u32 len)
+/*
+**		Write to a pipe without being killed by SIGPIPE when the
+**		child has closed it: the signal is held back during the
+**		write and taken if the write raised it (EPIPE).
+**
+***********************************************************************/
+{
+	struct timespec zero = {0, 0};
+	sigset_t pipe_set;
+	sigset_t old_set;
+	sigset_t pending;
+	int was_pending;
+	int err;
+	ssize_t n;
+
+	sigemptyset(&pipe_set);
+	sigaddset(&pipe_set, SIGPIPE);
+	sigpending(&pending);
+	was_pending = sigismember(&pending, SIGPIPE);
+	sigprocmask(SIG_BLOCK, &pipe_set, &old_set);
+
+	n = write(fd, data, len);
+	if (n < 0 && errno == EPIPE && !was_pending) {
+		err = errno;
+		sigtimedwait(&pipe_set, NULL, &zero);
+		errno = err;
+	}
+
+	sigprocmask(SIG_SETMASK, &old_set, NULL);
+	return n;
+}
+
+
+/***********************************************************************
+**
+*/	static DEVICE_CMD Service_Process(REBREQ *req, REBPRC *prc)
+/*
+**		Make progress on the outstanding write and read. Each one
+**		signals its own event when done, so the request stays
+**		pending while either of them is still outstanding.
+**
+***********************************************************************/
+{
+	ssize_t n;
+
+	// Feed the input:
+	if (prc->in >= 0 && prc->wdone < prc->wlen) {
+		n = Write_Pipe(prc->in, prc->wdata + prc->wdone, prc->wlen - prc->wdone);
+		if (n >= 0) prc->wdone += n;
+		else if (errno != EAGAIN && errno != EINTR) {
+			req->error = errno;
+			prc->wdone = prc->wlen;
+			prc->closing = 1;
+			Signal_Device(req, EVT_ERROR);
+		}
+		if (prc->wdone == prc->wlen) {
+			OS_Free(prc->wdata);
+			prc->wdata = 0;
+			prc->wlen = prc->wdone = 0;
+			if (n >= 0) Signal_Device(req, EVT_WROTE);
+		}
+	}
+	if (prc->in >= 0 && prc->closing && prc->wlen == 0) {
+		close(prc->in);	// the child sees its EOF
+		prc->in = -1;
+	}
+
+	// Take the output:
+	if (prc->want) {
+		if (prc->out < 0) n = 0;
+		else n = read(prc->out, prc->buf, MIN(prc->want, PRC_BUF_SIZE));
+		if (n > 0) {
+			prc->want = 0;
+			req->process.count = n;
+			Signal_Device(req, EVT_READ);
+		}
+		else if (n == 0) {
+			prc->want = 0;
+			if (prc->out >= 0) {
+				close(prc->out);
+				prc->out = -1;
+			}
+			Update_Process(req, prc);
+			Signal_Device(req, EVT_CLOSE);
+		}
+		else if (errno != EAGAIN && errno != EINTR) {
+			prc->want = 0;
+			req->error = errno;
+			Signal_Device(req, EVT_ERROR);
+		}
+	}
+
+	if (prc->want || prc->wlen || (prc->closing && prc->in >= 0)) return DR_PEND;
+	return DR_DONE;
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Open_Process(REBREQ *req)
+/*
+**		Start the command. Its argument vector is passed in the
+**		data field and the argument count in the length field.
+**		RPM_SHELL runs it from the shell, RPM_MERGE sends its
+**		stderr to the output pipe (otherwise stderr is inherited).
+**
+***********************************************************************/
+{
+	char **argv = (char**)req->data;
+	int argc = req->length;
+	char **args = argv;
+	int in_pipe[2];
+	int out_pipe[2];
+	int info_pipe[2];
+	int err = 0;
+	int pid;
+	REBPRC *prc;
+
+	if (GET_FLAG(req->modes, RPM_SHELL)) {
+		char *sh = getenv("SHELL");
+		args = OS_Make((argc + 3) * sizeof(char*));
+		args[0] = sh ? sh : "/bin/sh";
+		args[1] = "-c";
+		memcpy(&args[2], argv, (argc + 1) * sizeof(char*));
+	}
+
+	if (pipe2(in_pipe, O_CLOEXEC) < 0) goto error;
+	if (pipe2(out_pipe, O_CLOEXEC) < 0) goto in_error;
+	if (pipe2(info_pipe, O_CLOEXEC) < 0) goto out_error;
+
+	pid = fork();
+	if (pid < 0) goto info_error;
+	if (pid == 0) {
+		/* child */
+		sigset_t none;
+
+		if (dup2(in_pipe[0], STDIN_FILENO) < 0) goto child_error;
+		if (dup2(out_pipe[1], STDOUT_FILENO) < 0) goto child_error;
+		if (GET_FLAG(req->modes, RPM_MERGE)
+			&& dup2(STDOUT_FILENO, STDERR_FILENO) < 0) goto child_error;
+
+		// Signals held back by signal ports stay blocked over exec:
+		sigemptyset(&none);
+		sigprocmask(SIG_SETMASK, &none, NULL);
+
+		execvp(args[0], args);
+child_error:
+		err = errno;
+		// If the error cannot be sent, the parent sees exit code 127:
+		while (write(info_pipe[1], &err, sizeof(err)) < 0 && errno == EINTR);
+		_exit(127); /* get here only when exec fails */
+	}
+
+	/* parent */
+	close(in_pipe[0]);
+	close(out_pipe[1]);
+	close(info_pipe[1]);
+
+	// The info pipe closes on exec, or brings the exec error:
+	while (read(info_pipe[0], &err, sizeof(err)) < 0 && errno == EINTR);
+	close(info_pipe[0]);
+	if (args != argv) OS_Free(args);
+
+	if (err) {
+		close(in_pipe[1]);
+		close(out_pipe[0]);
+		waitpid(pid, NULL, 0);
+		req->error = err;
+		return DR_ERROR;
+	}
+
+	fcntl(in_pipe[1], F_SETFL, fcntl(in_pipe[1], F_GETFL) | O_NONBLOCK);
+	fcntl(out_pipe[0], F_SETFL, fcntl(out_pipe[0], F_GETFL) | O_NONBLOCK);
+
+	prc = OS_Make(sizeof(REBPRC));
+	CLEARS(prc);
+	prc->pid = pid;
+	prc->in = in_pipe[1];
+	prc->out = out_pipe[0];
+	prc->next = Processes;
+	Processes = prc;
+
+	req->handle = prc;
+	req->process.pid = pid;
+	req->process.output = prc->buf;
+	req->process.count = 0;
+	req->process.exit_code = -1;
+	SET_OPEN(req);
+
+	return DR_DONE;
+
+info_error:
+	err = errno;
+	close(info_pipe[0]);
+	close(info_pipe[1]);
+	errno = err;
+out_error:
+	err = errno;
+	close(out_pipe[0]);
+	close(out_pipe[1]);
+	errno = err;
+in_error:
+	err = errno;
+	close(in_pipe[0]);
+	close(in_pipe[1]);
+	errno = err;
+error:
+	err = errno;
+	if (args != argv) OS_Free(args);
+	req->error = err;
+	return DR_ERROR;
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Close_Process(REBREQ *req)
+/*
+**		Close the pipes. The child is not killed; its exit code is
+**		kept if it has already exited.
+**
+***********************************************************************/
+{
+	REBPRC *prc = req->handle;
+	REBPRC **node;
+
+	if (prc) {
+		if (prc->in >= 0) close(prc->in);
+		if (prc->out >= 0) close(prc->out);
+		Update_Process(req, prc);
+
+		for (node = &Processes; *node; node = &(*node)->next) {
+			if (*node == prc) {
+				*node = prc->next;
+				break;
+			}
+		}
+		if (prc->wdata) OS_Free(prc->wdata);
+		OS_Free(prc);
+		req->handle = 0;
+	}
+
+	req->process.output = 0;
+	req->process.count = 0;
+	SET_CLOSED(req);
+	return DR_DONE;
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Read_Process(REBREQ *req)
+/*
+**		Ask for the next output chunk, of up to length bytes. The
+**		length is taken by the first call, so polls that retry the
+**		command do not start another read.
+**
+***********************************************************************/
+{
+	REBPRC *prc = req->handle;
+
+	if (req->length) {
+		prc->want = req->length;
+		req->length = 0;
+	}
+
+	return Service_Process(req, prc);
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Write_Process(REBREQ *req)
+/*
+**		Queue data for the child stdin (the data is copied). An
+**		empty write closes stdin once the queued data is written.
+**		The data is taken by the first call, as for a read.
+**
+***********************************************************************/
+{
+	REBPRC *prc = req->handle;
+	REBYTE *data;
+
+	if (req->data) {
+		if (prc->in < 0 || prc->closing) {
+			req->error = EPIPE;
+			return DR_ERROR;
+		}
+		if (req->length == 0) prc->closing = 1;
+		else {
+			data = OS_Make(prc->wlen - prc->wdone + req->length);
+			memcpy(data, prc->wdata + prc->wdone, prc->wlen - prc->wdone);
+			memcpy(data + prc->wlen - prc->wdone, req->data, req->length);
+			if (prc->wdata) OS_Free(prc->wdata);
+			prc->wlen = prc->wlen - prc->wdone + req->length;
+			prc->wdone = 0;
+			prc->wdata = data;
+		}
+		req->data = 0;
+		req->length = 0;
+	}
+
+	return Service_Process(req, prc);
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Query_Process(REBREQ *req)
+/*
+**		Update the exit code.
+**
+***********************************************************************/
+{
+	REBPRC *prc = req->handle;
+
+	if (prc) Update_Process(req, prc);
+	return DR_DONE;
+}
+
+
+/***********************************************************************
+**
+**	Command Dispatch Table (RDC_ enum order)
+**
+***********************************************************************/
+
+static DEVICE_CMD_FUNC Dev_Cmds[RDC_MAX] =
+{
+	0,
+	0,
+	Open_Process,
+	Close_Process,
+	Read_Process,
+	Write_Process,
+	0,	// poll
+	0,	// connect
+	Query_Process,
+};
+
+DEFINE_DEV(Dev_Process, "Process", 1, Dev_Cmds, RDC_MAX, 0);
+
+#endif //HAS_POSIX_PROCESS
@@ -105,6 +105,10 @@ int os_init_gtk(void *libgtk);
 
 void OS_Destroy_Graphics(void);
 
+#ifdef HAS_POSIX_PROCESS
+void Exited_Process(int pid, int status);
+#endif
+
 
 
 /***********************************************************************
@@ -117,17 +121,19 @@ void OS_Destroy_Graphics(void);
 **
 ***********************************************************************/
 {
+	// (Uses the _r functions, as several interpreters may run at once.)
 #ifdef HAS_SMART_TIMEZONE
+	struct tm tm1, tm2;
 	time_t rightnow;
 	time(&rightnow);
-	return (int)difftime(mktime(localtime(&rightnow)), mktime(gmtime(&rightnow))) / 60;
+	return (int)difftime(mktime(localtime_r(&rightnow, &tm1)), mktime(gmtime_r(&rightnow, &tm2))) / 60;
 #else
-	struct tm tm2;
+	struct tm tm1, tm2;
 	time_t rightnow;
 	time(&rightnow);
-	tm2 = *localtime(&rightnow);
+	localtime_r(&rightnow, &tm2);
 	tm2.tm_isdst=0;
-	return (int)difftime(mktime(&tm2), mktime(gmtime(&rightnow))) / 60;
+	return (int)difftime(mktime(&tm2), mktime(gmtime_r(&rightnow, &tm1))) / 60;
 #endif
 //	 return local_tm->tm_gmtoff / 60;  // makes the most sense, but no longer used
 }
@@ -142,11 +148,12 @@ void OS_Destroy_Graphics(void);
 **
 ***********************************************************************/
 {
+	struct tm tm;
 	struct tm *time;
 
 	CLEARS(dat);
 
-	time = gmtime(stime);
+	time = gmtime_r(stime, &tm);
 
 	dat->year  = time->tm_year + 1900;
 	dat->month = time->tm_mon + 1;
@@ -701,14 +708,25 @@ error:
 **		provide a precise time sampling method. So, if the target
 **		posix OS does, add the ifdef code in here.
 **
+**		The monotonic clock is used where available, so that
+**		timers are not upset by changes of the system clock.
+**
 ***********************************************************************/
 {
-	struct timeval tv;
 	i64 time;
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	time = ((i64)ts.tv_sec * 1000000) + ts.tv_nsec / 1000;
+#else
+	struct timeval tv;
 
 	gettimeofday(&tv,0);
 
 	time = ((i64)tv.tv_sec * 1000000) + tv.tv_usec;
+#endif
 
 	if (base == 0) return time;
 
@@ -1324,9 +1342,22 @@ stdin_pipe_err:
  * 		0: return immediately
  *
 **		Return -1 on error
+**
+**		A reaped process port child is passed on to its device, as
+**		the port still has to report its exit code.
+**
 ***********************************************************************/
 {
-	return waitpid(pid, status, flags == 0? WNOHANG : 0);
+	int st = 0;
+	int xpid = waitpid(pid, &st, flags == 0? WNOHANG : 0);
+
+	if (xpid > 0) {
+		if (status != NULL) *status = st;
+#ifdef HAS_POSIX_PROCESS
+		Exited_Process(xpid, st);
+#endif
+	}
+	return xpid;
 }
 
 static int Try_Browser(char *browser, REBCHR *url)
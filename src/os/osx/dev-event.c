@@ -82,7 +82,7 @@ void Done_Device(int handle, int error);
 **
 */	DEVICE_CMD Query_Events(REBREQ *req)
 /*
-**		Wait for an event, or a timeout (in milliseconds) specified by
+**		Wait for an event, or a timeout (in microseconds) specified by
 **		req->length. The latter is used by WAIT as the main timing
 **		method.
 **
@@ -91,8 +91,8 @@ void Done_Device(int handle, int error);
 	struct timeval tv;
 	int result;
 
-	tv.tv_sec = 0;
-	tv.tv_usec = req->length * 1000;
+	tv.tv_sec = req->length / 1000000;
+	tv.tv_usec = req->length % 1000000;
 	//printf("usec %d\n", tv.tv_usec);
 	
 	result = select(0, 0, 0, 0, &tv);
@@ -427,14 +427,25 @@ static void *Task_Ready;
 **		provide a precise time sampling method. So, if the target
 **		posix OS does, add the ifdef code in here.
 **
+**		The monotonic clock is used where available, so that
+**		timers are not upset by changes of the system clock.
+**
 ***********************************************************************/
 {
-	struct timeval tv;
 	i64 time;
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	time = ((i64)ts.tv_sec * 1000000) + ts.tv_nsec / 1000;
+#else
+	struct timeval tv;
 
 	gettimeofday(&tv,0);
 
 	time = ((i64)tv.tv_sec * 1000000) + tv.tv_usec;
+#endif
 
 	if (base == 0) return time;
 
@@ -154,7 +154,8 @@ extern HINSTANCE App_Instance;	// From Main module.
 **
 */	DEVICE_CMD Query_Events(REBREQ *req)
 /*
-**		Wait for an event or a timeout sepecified by req->length.
+**		Wait for an event or a timeout sepecified by req->length
+**		(in microseconds, rounded up to the millisecond timer).
 **		This is used by WAIT as the main timing method.
 **
 ***********************************************************************/
@@ -162,7 +163,7 @@ extern HINSTANCE App_Instance;	// From Main module.
 	MSG msg;
 
 	// Set timer (we assume this is very fast):
-	Timer_Id = SetTimer(0, Timer_Id, req->length, 0);
+	Timer_Id = SetTimer(0, Timer_Id, (req->length + 999) / 1000, 0);
 
 	// Wait for message or the timer:
 	if (GetMessage(&msg, NULL, 0, 0)) {
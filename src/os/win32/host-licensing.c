@@ -8,7 +8,7 @@
 #include "../../c-code/extensions/licensing/src/r3-ext.c"
 
 
-extern int RX_Call(int cmd, RXIFRM *frm, void *data);
+extern int RX_Call(int cmd, RXIFRM *frm, REBCEC *ctx);
 
 RL_LIB *RL; // Link back to reb-lib from embedded extensions
 
@@ -20,5 +20,5 @@ RL_LIB *RL; // Link back to reb-lib from embedded extensions
 **
 ***********************************************************************/
 {
-	RL = RL_Extend((REBYTE *)(&RX_licensing[0]), (RXICAL)&RX_Call);
+	RL = RL_Extend((REBYTE *)(&RX_licensing[0]), &RX_Call);
 }
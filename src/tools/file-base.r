@@ -36,6 +36,7 @@ core: [
 	f-dtoa.c
 	f-enbase.c
 	f-extension.c
+	f-float.c
 	f-math.c
 	f-modify.c
 	f-qsort.c
@@ -64,6 +65,7 @@ core: [
 	p-file.c
 	p-net.c
 	p-serial.c
+	p-timer.c
 	s-cases.c
 	s-crc.c
 	s-file.c
@@ -92,6 +94,7 @@ core: [
 	t-pair.c
 	t-port.c
 	t-string.c
+	t-table.c
 	t-time.c
 	t-tuple.c
 	t-typeset.c
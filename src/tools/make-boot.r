@@ -1086,6 +1086,66 @@ boot-ops: load %ops.r
 write %boot-code.r mold reduce sections
 data: mold/flat reduce sections
 insert data reduce ["; Copyright (C) REBOL Technologies " now newline]
+
+;-- Create boot image: the scanned form of the data above (see Load_Boot).
+; Words are stored as indexes into a table of their spellings (in the
+; order the scanner would first meet them), blocks with their length,
+; strings and integers as their contents. Other values are kept as text
+; for the scanner. The type byte is the datatype number, plus 128 when
+; a new line is marked before the value.
+image: make binary! length? data
+image-words: make binary! 30000
+image-syms: make map! 4000
+
+image-num: func [out n] [
+	while [n >= 128] [append out (n // 128) + 128  n: to integer! n / 128]
+	append out n
+]
+
+image-value: func [blk /local val type bin sym] [
+	val: first blk
+	type: to word! head remove back tail form type?/word :val
+	type: (index? find datatypes type) - 1 + either all [block? blk new-line? blk] [128][0]
+	case [
+		any-word? :val [
+			bin: to binary! to string! to word! :val
+			unless sym: select image-syms bin [
+				repend image-syms [bin sym: length? image-syms]
+				image-num image-words length? bin
+				append image-words bin
+			]
+			append image type
+			image-num image sym
+		]
+		any-block? :val [
+			append image type
+			image-block :val
+		]
+		string? :val [
+			append image type
+			image-num image length? bin: to binary! val
+			append image bin
+		]
+		integer? :val [
+			append image type
+			append image reverse to binary! val
+		]
+		true [
+			append image type and 128 ; scanned from text
+			append image to binary! mold :val
+			append image 0
+		]
+	]
+]
+
+image-block: func [blk] [
+	image-num image length? blk
+	forall blk [image-value blk]
+]
+
+image-block load/all data
+image: rejoin [#{52424931} image-num copy #{} length? image-syms image-words image]
+
 insert tail data make char! 0 ; scanner requires zero termination
 
 comp-data: compress data: to-binary data
@@ -1114,6 +1174,17 @@ emit binary-to-c reverse (skip data-len-bin 4)
 emit binary-to-c comp-data
 emit-end/easy
 
+emit [
+{
+	// The same data as scanned values (see Load_Block_Image), so that
+	// Load_Boot need not decompress and scan the text.
+}
+]
+
+emit ["const REBYTE Boot_Image[" length? image "] = {^/^-"]
+emit binary-to-c image
+emit-end/easy
+
 write src/b-boot.c out
 
 ;-- Output stats:
@@ -1122,6 +1193,7 @@ print [
 	to-integer ((length? comp-data) / (length? data) * 100)
 	"percent of original"
 ]
+print ["Boot image" length? image "bytes"]
 
 ;-- Create platform string:
 ;platform: to-string platform
@@ -1145,9 +1217,11 @@ emit [
 {
 #define MAX_NATS      } nat-count {
 #define NAT_SPEC_SIZE } length? comp-data {
+#define BOOT_IMAGE_SIZE } length? image {
 #define CHECK_TITLE   } checksum to binary! title {
 
 extern const REBYTE Native_Specs[];
+extern const REBYTE Boot_Image[];
 extern const REBFUN Native_Funcs[];
 
 typedef struct REBOL_Boot_Block ^{
@@ -238,15 +238,15 @@ form-header/gen "REBOL Host and Extension API" %reb-lib.r %make-reb-lib.r
 // sizes to inform the developer that something is wrong.
 #if defined(__LP64__) || defined(__LLP64__)
 #ifdef HAS_POSIX_SIGNAL
-#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 196 && sizeof(REBEVT) == 16)
+#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 204 && sizeof(REBEVT) == 16)
 #else
-#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 100 && sizeof(REBEVT) == 16)
+#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 132 && sizeof(REBEVT) == 16)
 #endif //HAS_POSIX_SIGNAL
 #else
 #ifdef HAS_POSIX_SIGNAL
-#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 180 && sizeof(REBEVT) == 12)
+#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 184 && sizeof(REBEVT) == 12)
 #else
-#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 80 && sizeof(REBEVT) == 12)
+#define CHECK_STRUCT_ALIGN (sizeof(REBREQ) == 108 && sizeof(REBEVT) == 12)
 #endif //HAS_POSIX_SIGNAL
 #endif
 
@@ -266,7 +266,7 @@ rlib
 
 RXIEXT const char *RX_Init(int opts, RL_LIB *lib);
 RXIEXT int RX_Quit(int opts);
-RXIEXT int RX_Call(int cmd, RXIFRM *frm, void *data);
+RXIEXT int RX_Call(int cmd, RXIFRM *frm, REBCEC *ctx); // an RXICAL
 
 // The macros below will require this base pointer:
 extern RL_LIB *RL;  // is passed to the RX_Init() function